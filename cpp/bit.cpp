@@ -136,6 +136,31 @@ int main(int argc, char* argv[])
     auto f6 = [=](auto first, auto last){
         std::reverse(first, last);
     };
+    auto f7 = [=](auto first, auto last){
+        auto bfirst = bit_iterator<decltype(first)>(first);
+        auto blast = bit_iterator<decltype(last)>(last);
+        const std::ptrdiff_t size = blast - bfirst;
+        const std::ptrdiff_t half = size / 2;
+        const std::ptrdiff_t step = 2654435761 % size | 1;
+        const auto bmiddle = bfirst + half;
+        for (std::ptrdiff_t i = 0, pos = 0; i < size; ++i) {
+            bmiddle[pos - half].flip();
+            pos += step;
+            pos -= pos >= size ? size : 0;
+        }
+    };
+    auto f8 = [=](auto first, auto last){
+        auto bfirst = bit_iterator<decltype(first)>(first);
+        auto blast = bit_iterator<decltype(last)>(last);
+        const std::ptrdiff_t size = blast - bfirst;
+        const std::ptrdiff_t step = 2654435761 % size | 1;
+        for (std::ptrdiff_t i = 0, pos = 0; i < size; ++i) {
+            auto it = blast - (size - pos);
+            (*it).flip();
+            pos += step - (it - bfirst) % 2;
+            pos -= pos >= size ? size : 0;
+        }
+    };
     
     // Benchmark
     std::cout<<"f0 = "<<benchmark(v, f0, k = 0)<<" ";
@@ -152,6 +177,10 @@ int main(int argc, char* argv[])
     std::cout<<k<<std::endl;
     std::cout<<"f6 = "<<benchmark(vb, f6, k = 0)<<" ";
     std::cout<<k<<std::endl;
+    std::cout<<"f7 = "<<benchmark(v, f7, k = 0)<<" ";
+    std::cout<<k<<std::endl;
+    std::cout<<"f8 = "<<benchmark(v, f8, k = 0)<<" ";
+    std::cout<<k<<std::endl;
     
     // Finalization
     return static_cast<int>(k);
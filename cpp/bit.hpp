@@ -16,11 +16,22 @@
 // C++ standard library
 // Project sources
 #include "bit_details.hpp"
+#include "bit_word_block.hpp"
 #include "bit_value.hpp"
 #include "bit_reference.hpp"
 #include "bit_pointer.hpp"
 #include "bit_iterator.hpp"
 #include "bit_algorithm.hpp"
+#include "bit_atomic.hpp"
+#include "bit_arithmetic.hpp"
+#include "bit_stream.hpp"
+#include "bit_transpose.hpp"
+#include "bit_hash.hpp"
+#include "bit_rank_select.hpp"
+#include "bit_roaring.hpp"
+#include "bit_mapped_span.hpp"
+#include "bit_vector.hpp"
+#include "bit_serialization.hpp"
 // Third-party libraries
 // Miscellaneous
 // ========================================================================== //
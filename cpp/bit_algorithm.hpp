@@ -15,6 +15,18 @@
 
 // ================================ PREAMBLE ================================ //
 // C++ standard library
+#include <functional>
+// Define BIT_EXECUTION_POLICIES to enable the overloads on execution policies
+#if defined(BIT_EXECUTION_POLICIES) && __cplusplus >= 201703L \
+ && defined(__has_include)
+#if __has_include(<execution>)
+#include <future>
+#include <thread>
+#include <vector>
+#include <execution>
+#define _BIT_EXECUTION_POLICIES
+#endif
+#endif
 // Project sources
 #include "bit_details.hpp"
 #include "bit_value.hpp"
@@ -31,19 +43,306 @@ namespace bit {
 /* ************************** STANDARD ALGORITHMS *************************** */
 // Non-modifying sequence operations
 template <class InputIt> 
-typename bit_iterator<InputIt>::difference_type
+constexpr typename bit_iterator<InputIt>::difference_type
 count(
     bit_iterator<InputIt> first, 
     bit_iterator<InputIt> last, 
     bit_value value
 );
+template <class InputIt1, class InputIt2, class BinaryOperation>
+constexpr typename bit_iterator<InputIt1>::difference_type
+transform_count(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2,
+    BinaryOperation binary_op
+);
+template <class InputIt1, class InputIt2, class T>
+constexpr T transform_reduce(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2,
+    T init
+);
+template <
+    class InputIt1,
+    class InputIt2,
+    class T,
+    class BinaryReductionOp,
+    class BinaryTransformOp
+>
+constexpr T transform_reduce(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2,
+    T init,
+    BinaryReductionOp reduce,
+    BinaryTransformOp transform
+);
+template <
+    class InputIt,
+    class T,
+    class BinaryReductionOp,
+    class UnaryTransformOp
+>
+constexpr T transform_reduce(
+    bit_iterator<InputIt> first,
+    bit_iterator<InputIt> last,
+    T init,
+    BinaryReductionOp reduce,
+    UnaryTransformOp transform
+);
+template <class InputIt>
+constexpr bit_iterator<InputIt> find(
+    bit_iterator<InputIt> first,
+    bit_iterator<InputIt> last,
+    bit_value value
+);
+template <class BidirIt>
+constexpr bit_iterator<BidirIt> find_last(
+    bit_iterator<BidirIt> first,
+    bit_iterator<BidirIt> last,
+    bit_value value
+);
+template <class InputIt1, class InputIt2>
+constexpr std::pair<bit_iterator<InputIt1>, bit_iterator<InputIt2>> mismatch(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2
+);
+template <class InputIt1, class InputIt2>
+constexpr bool equal(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2
+);
 
 // Modifying sequence operations
+template <class InputIt, class OutputIt>
+constexpr bit_iterator<OutputIt> copy(
+    bit_iterator<InputIt> first,
+    bit_iterator<InputIt> last,
+    bit_iterator<OutputIt> d_first
+);
+template <class InputIt, class Size, class OutputIt>
+constexpr bit_iterator<OutputIt> copy_n(
+    bit_iterator<InputIt> first,
+    Size count,
+    bit_iterator<OutputIt> d_first
+);
+template <class BidirIt1, class BidirIt2>
+constexpr bit_iterator<BidirIt2> copy_backward(
+    bit_iterator<BidirIt1> first,
+    bit_iterator<BidirIt1> last,
+    bit_iterator<BidirIt2> d_last
+);
+template <class InputIt, class OutputIt, class UnaryOperation>
+constexpr bit_iterator<OutputIt> transform(
+    bit_iterator<InputIt> first,
+    bit_iterator<InputIt> last,
+    bit_iterator<OutputIt> d_first,
+    UnaryOperation unary_op
+);
+template <class InputIt1, class InputIt2, class OutputIt, class BinaryOperation>
+constexpr bit_iterator<OutputIt> transform(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2,
+    bit_iterator<OutputIt> d_first,
+    BinaryOperation binary_op
+);
+template <class ForwardIt>
+constexpr void fill(
+    bit_iterator<ForwardIt> first,
+    bit_iterator<ForwardIt> last,
+    bit_value value
+);
+template <class OutputIt, class Size>
+constexpr bit_iterator<OutputIt> fill_n(
+    bit_iterator<OutputIt> first,
+    Size count,
+    bit_value value
+);
+template <class ForwardIt, class Generator>
+constexpr void generate(
+    bit_iterator<ForwardIt> first,
+    bit_iterator<ForwardIt> last,
+    Generator g
+);
 template <class BidirIt> 
-void reverse(
+constexpr void reverse(
     bit_iterator<BidirIt> first, 
     bit_iterator<BidirIt> last
 );
+template <class BidirIt>
+constexpr bit_iterator<BidirIt> rotate(
+    bit_iterator<BidirIt> first,
+    bit_iterator<BidirIt> n_first,
+    bit_iterator<BidirIt> last
+);
+template <class ForwardIt>
+constexpr bit_iterator<ForwardIt> shift_left(
+    bit_iterator<ForwardIt> first,
+    bit_iterator<ForwardIt> last,
+    typename bit_iterator<ForwardIt>::difference_type n
+);
+template <class BidirIt>
+constexpr bit_iterator<BidirIt> shift_right(
+    bit_iterator<BidirIt> first,
+    bit_iterator<BidirIt> last,
+    typename bit_iterator<BidirIt>::difference_type n
+);
+
+// Comparison operations
+template <class InputIt1, class InputIt2>
+constexpr bool lexicographical_compare(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2,
+    bit_iterator<InputIt2> last2
+);
+/* ************************************************************************** */
+
+
+
+/* ************************** SELECTION ALGORITHMS ************************** */
+// Compaction and expansion operations
+template <class InputIt1, class InputIt2, class OutputIt>
+constexpr bit_iterator<OutputIt> pack(
+    bit_iterator<InputIt1> first,
+    bit_iterator<InputIt1> last,
+    bit_iterator<InputIt2> mask_first,
+    bit_iterator<OutputIt> d_first
+);
+template <class InputIt1, class InputIt2, class OutputIt>
+constexpr bit_iterator<OutputIt> unpack(
+    bit_iterator<InputIt1> mask_first,
+    bit_iterator<InputIt1> mask_last,
+    bit_iterator<InputIt2> first,
+    bit_iterator<OutputIt> d_first
+);
+template <class RandomIt, class InputIt, class OutputIt>
+constexpr OutputIt gather(
+    RandomIt first,
+    RandomIt last,
+    bit_iterator<InputIt> mask_first,
+    OutputIt d_first
+);
+
+// Reduction operations
+template <class RandomIt, class InputIt, class T>
+constexpr T masked_sum(
+    RandomIt first,
+    RandomIt last,
+    bit_iterator<InputIt> mask_first,
+    T init
+);
+/* ************************************************************************** */
+
+
+
+/* ******************** IMPLEMENTATION DETAILS: REVERSAL ******************** */
+// Mirrored swap
+template <class BidirIt>
+void _reverse_swap(
+    bit_iterator<BidirIt> first,
+    bit_iterator<BidirIt> last,
+    bit_iterator<BidirIt> d_last
+);
+/* ************************************************************************** */
+
+
+
+/* ************** IMPLEMENTATION DETAILS: SEGMENTED EXECUTION *************** */
+// Segment traversal
+template <class Iterator, class Function>
+void _for_each_segment(
+    bit_iterator<Iterator> first,
+    bit_iterator<Iterator> last,
+    Function f,
+    std::true_type
+);
+template <class Iterator, class Function>
+void _for_each_segment(
+    bit_iterator<Iterator> first,
+    bit_iterator<Iterator> last,
+    Function f,
+    std::false_type
+) noexcept;
+
+// Modifying sequence operations
+template <class BidirIt>
+void _reverse_segments(
+    bit_iterator<BidirIt> first,
+    bit_iterator<BidirIt> last,
+    std::true_type
+);
+template <class BidirIt>
+void _reverse_segments(
+    bit_iterator<BidirIt> first,
+    bit_iterator<BidirIt> last,
+    std::false_type
+) noexcept;
+/* ************************************************************************** */
+
+
+
+/* ************************** PARALLEL ALGORITHMS *************************** */
+#if defined(_BIT_EXECUTION_POLICIES)
+// Execution policy constraint
+template <class ExecutionPolicy, class T>
+using _enable_if_execution_policy_t = typename std::enable_if<
+    std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value,
+    T
+>::type;
+
+// Parallel execution
+template <class ExecutionPolicy, class Size>
+Size _parallel_chunks(Size words);
+template <class Size>
+std::vector<Size> _parallel_split(Size n, Size chunks, Size pos, Size digits);
+
+// Non-modifying sequence operations
+template <class ExecutionPolicy, class RandomIt>
+_enable_if_execution_policy_t<
+    ExecutionPolicy, 
+    typename bit_iterator<RandomIt>::difference_type
+> count(
+    ExecutionPolicy&& policy,
+    bit_iterator<RandomIt> first, 
+    bit_iterator<RandomIt> last, 
+    bit_value value
+);
+template <class ExecutionPolicy, class RandomIt>
+_enable_if_execution_policy_t<ExecutionPolicy, bit_iterator<RandomIt>> find(
+    ExecutionPolicy&& policy,
+    bit_iterator<RandomIt> first,
+    bit_iterator<RandomIt> last,
+    bit_value value
+);
+
+// Modifying sequence operations
+template <class ExecutionPolicy, class RandomIt1, class RandomIt2>
+_enable_if_execution_policy_t<ExecutionPolicy, bit_iterator<RandomIt2>> copy(
+    ExecutionPolicy&& policy,
+    bit_iterator<RandomIt1> first,
+    bit_iterator<RandomIt1> last,
+    bit_iterator<RandomIt2> d_first
+);
+template <class ExecutionPolicy, class RandomIt>
+_enable_if_execution_policy_t<ExecutionPolicy, void> fill(
+    ExecutionPolicy&& policy,
+    bit_iterator<RandomIt> first,
+    bit_iterator<RandomIt> last,
+    bit_value value
+);
+template <class ExecutionPolicy, class RandomIt>
+_enable_if_execution_policy_t<ExecutionPolicy, void> reverse(
+    ExecutionPolicy&& policy,
+    bit_iterator<RandomIt> first,
+    bit_iterator<RandomIt> last
+);
+#endif
 /* ************************************************************************** */
 
 
@@ -51,7 +350,7 @@ void reverse(
 // ------------------- NON-MODIFYING SEQUENCE OPERATIONS -------------------- //
 // Counts the number of bits equal to the provided bit value
 template <class InputIt> 
-typename bit_iterator<InputIt>::difference_type
+constexpr typename bit_iterator<InputIt>::difference_type
 count(
     bit_iterator<InputIt> first, 
     bit_iterator<InputIt> last, 
@@ -62,8 +361,13 @@ count(
     _assert_range_viability(first, last);
     
     // Types and constants
-    using word_type = typename bit_iterator<InputIt>::word_type;
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<InputIt>::word_type
+    >::type;
     using difference_type = typename bit_iterator<InputIt>::difference_type;
+    using segmented_type = typename segmented_iterator_traits<
+        InputIt
+    >::is_segmented_iterator;
     constexpr difference_type digits = binary_digits<word_type>::value;
     
     // Initialization
@@ -72,6 +376,18 @@ count(
     word_type first_value = {};
     word_type last_value = {};
     
+    // Computation segment by segment when the range is segmented
+    if (segmented_type::value) {
+        _for_each_segment(first, last, [&result, value](
+            auto local_first,
+            auto local_last
+        ){
+            result += bit::count(local_first, local_last, value);
+        }, segmented_type());
+        return result;
+    }
+    _BIT_RECORD(count, _range_path(first, last), first, last);
+
     // Computation when bits belong to several underlying words
     if (first.base() != last.base()) {
         if (first.position() != 0) {
@@ -79,6 +395,11 @@ count(
             result = _popcnt(first_value);
             ++it;
         }
+        if (_is_contiguous_iterator<InputIt>::value && it != last.base()
+         && !_is_constant_evaluated()) {
+            result += _vpopcnt(&*it, &*it + std::distance(it, last.base()));
+            it = last.base();
+        }
         for (; it != last.base(); ++it) {
             result += _popcnt(*it);
         }
@@ -87,7 +408,7 @@ count(
             result += _popcnt(last_value);
         }
     // Computation when bits belong to the same underlying word
-    } else {
+    } else if (first.position() != last.position()) {
         result = _popcnt(_bextr<word_type>(
             *first.base(), 
             first.position(), 
@@ -103,98 +424,1936 @@ count(
     // Finalization
     return result;
 }
-// -------------------------------------------------------------------------- //
 
+// Counts the bits set to 1 in the word-wise result of a bitwise operation
+template <class InputIt1, class InputIt2, class BinaryOperation>
+constexpr typename bit_iterator<InputIt1>::difference_type
+transform_count(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2,
+    BinaryOperation binary_op
+)
+{
+    using difference_type = typename bit_iterator<InputIt1>::difference_type;
+    return transform_reduce(
+        first1,
+        last1,
+        first2,
+        difference_type(),
+        std::plus<difference_type>(),
+        binary_op
+    );
+}
 
+// Adds to init the number of positions where both ranges have a bit set to 1
+template <class InputIt1, class InputIt2, class T>
+constexpr T transform_reduce(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2,
+    T init
+)
+{
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<InputIt1>::word_type
+    >::type;
+    return transform_reduce(
+        first1,
+        last1,
+        first2,
+        init,
+        std::plus<T>(),
+        std::bit_and<word_type>()
+    );
+}
 
-// --------------------- MODIFYING SEQUENCE OPERATIONS ---------------------- //
-// Reverses the order of the bits in the provided range
-template <class BidirIt> 
-void reverse(
-    bit_iterator<BidirIt> first, 
-    bit_iterator<BidirIt> last
+// Reduces with init the numbers of bits set to 1 in the word-wise results of
+// a bitwise operation on two ranges, in a single pass
+template <
+    class InputIt1,
+    class InputIt2,
+    class T,
+    class BinaryReductionOp,
+    class BinaryTransformOp
+>
+constexpr T transform_reduce(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2,
+    T init,
+    BinaryReductionOp reduce,
+    BinaryTransformOp transform
+)
+{
+    // Assertions
+    _assert_range_viability(first1, last1);
+    
+    // Types and constants
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<InputIt1>::word_type
+    >::type;
+    using difference_type = typename bit_iterator<InputIt1>::difference_type;
+    using size_type = typename bit_iterator<InputIt1>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    static_assert(std::is_same<
+        typename std::remove_cv<
+            typename bit_iterator<InputIt2>::word_type
+        >::type, word_type
+    >::value, "");
+    
+    // Initialization
+    size_type n = std::distance(first1, last1);
+    const size_type pos1 = first1.position();
+    size_type pos2 = first2.position();
+    size_type cnt = 0;
+    auto it1 = first1.base();
+    auto it2 = first2.base();
+    
+    // Reduces the bits of the first element of the first range if unaligned
+    if (pos1 != 0 && n != 0) {
+        cnt = std::min(n, digits - pos1);
+        init = reduce(init, static_cast<difference_type>(_popcnt(
+            _bextr<word_type>(static_cast<word_type>(transform(
+                static_cast<word_type>(*it1 >> pos1),
+                _read_word(it2, pos2, cnt)
+            )), 0, cnt)
+        )));
+        pos2 += cnt;
+        if (pos2 >= digits) {
+            pos2 -= digits;
+            ++it2;
+        }
+        n -= cnt;
+        ++it1;
+    }
+    
+    // Reduces the bits of whole elements of the first range
+    if (pos2 == 0) {
+        for (; n >= digits; n -= digits) {
+            init = reduce(init, static_cast<difference_type>(_popcnt(
+                static_cast<word_type>(transform(*it1, *it2))
+            )));
+            ++it1;
+            ++it2;
+        }
+    } else {
+        for (; n >= digits; n -= digits) {
+            init = reduce(init, static_cast<difference_type>(_popcnt(
+                static_cast<word_type>(transform(
+                    *it1,
+                    _shrd<word_type>(*it2, *std::next(it2), pos2)
+                ))
+            )));
+            ++it1;
+            ++it2;
+        }
+    }
+    
+    // Reduces the bits of the last element of the first range
+    if (n != 0) {
+        init = reduce(init, static_cast<difference_type>(_popcnt(
+            _bextr<word_type>(static_cast<word_type>(transform(
+                *it1,
+                _read_word(it2, pos2, n)
+            )), 0, n)
+        )));
+    }
+    
+    // Finalization
+    return init;
+}
+
+// Reduces with init the numbers of bits set to 1 in the word-wise results of
+// a bitwise operation on a range, in a single pass
+template <
+    class InputIt,
+    class T,
+    class BinaryReductionOp,
+    class UnaryTransformOp
+>
+constexpr T transform_reduce(
+    bit_iterator<InputIt> first,
+    bit_iterator<InputIt> last,
+    T init,
+    BinaryReductionOp reduce,
+    UnaryTransformOp transform
 )
 {
     // Assertions
     _assert_range_viability(first, last);
     
     // Types and constants
-    using word_type = typename bit_iterator<BidirIt>::word_type;
-    using size_type = typename bit_iterator<BidirIt>::size_type;
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<InputIt>::word_type
+    >::type;
+    using difference_type = typename bit_iterator<InputIt>::difference_type;
+    using size_type = typename bit_iterator<InputIt>::size_type;
     constexpr size_type digits = binary_digits<word_type>::value;
     
     // Initialization
-    const bool is_first_aligned = first.position() == 0;
-    const bool is_last_aligned = last.position() == 0;
-    size_type gap = (digits - last.position()) * !is_last_aligned;
+    size_type n = std::distance(first, last);
+    const size_type pos = first.position();
+    size_type cnt = 0;
     auto it = first.base();
-    word_type first_value = {};
-    word_type last_value = {};
     
-    // Reverse when bit iterators are aligned
-    if (is_first_aligned && is_last_aligned) {
-        std::reverse(first.base(), last.base());
-        for (; it !=  last.base(); ++it) {
-            *it = _bitswap(*it);
+    // Reduces the bits of the first element if unaligned
+    if (pos != 0 && n != 0) {
+        cnt = std::min(n, digits - pos);
+        init = reduce(init, static_cast<difference_type>(_popcnt(
+            _bextr<word_type>(static_cast<word_type>(transform(
+                static_cast<word_type>(*it >> pos)
+            )), 0, cnt)
+        )));
+        n -= cnt;
+        ++it;
+    }
+    
+    // Reduces the bits of whole elements
+    for (; n >= digits; n -= digits) {
+        init = reduce(init, static_cast<difference_type>(_popcnt(
+            static_cast<word_type>(transform(*it))
+        )));
+        ++it;
+    }
+    
+    // Reduces the bits of the last element
+    if (n != 0) {
+        init = reduce(init, static_cast<difference_type>(_popcnt(
+            _bextr<word_type>(static_cast<word_type>(transform(*it)), 0, n)
+        )));
+    }
+    
+    // Finalization
+    return init;
+}
+
+// Finds the first bit equal to the provided bit value
+template <class InputIt>
+constexpr bit_iterator<InputIt> find(
+    bit_iterator<InputIt> first,
+    bit_iterator<InputIt> last,
+    bit_value value
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+    
+    // Types and constants
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<InputIt>::word_type
+    >::type;
+    
+    // Initialization: zero bits are searched as ones in flipped words
+    const word_type flip = static_cast<bool>(value) 
+                         ? word_type() 
+                         : static_cast<word_type>(~word_type());
+    auto it = first.base();
+    word_type word = {};
+    _BIT_RECORD(find, _range_path(first, last), first, last);
+    
+    // Search when bits belong to several underlying words
+    if (first.base() != last.base()) {
+        if (first.position() != 0) {
+            word = static_cast<word_type>((*it ^ flip) >> first.position());
+            if (word) {
+                return bit_iterator<InputIt>(
+                    it, 
+                    first.position() + _tzcnt(word)
+                );
+            }
+            ++it;
         }
-    // Reverse when bit iterators do not belong to the same underlying word
-    } else if (first.base() != last.base()) {
-        // Save first and last element
-        first_value = *first.base();
-        last_value = *std::prev(last.base(), is_last_aligned);
-        // Reverse the underlying sequence
-        std::reverse(first.base(), std::next(last.base(), !is_last_aligned));
-        // Shift the underlying sequence to the left
-        if (first.position() < gap) {
-            it = first.base();
-            gap = gap - first.position();
-            for (; it != last.base(); ++it) {
-                *it = _shld<word_type>(*it, *std::next(it), gap);
+        for (; it != last.base(); ++it) {
+            word = *it ^ flip;
+            if (word) {
+                return bit_iterator<InputIt>(it, _tzcnt(word));
             }
-            *it <<= gap;
-            it = first.base();
-        // Shift the underlying sequence to the right
-        } else if (first.position() > gap) {
-            it = std::prev(last.base(), is_last_aligned);
-            gap = first.position() - gap;
-            for (; it != first.base(); --it) {
-                *it = _shrd<word_type>(*it, *std::prev(it), gap);
+        }
+        if (last.position() != 0) {
+            word = _bextr<word_type>(*it ^ flip, 0, last.position());
+            if (word) {
+                return bit_iterator<InputIt>(it, _tzcnt(word));
             }
-            *it >>= gap; 
-            it = first.base();
         }
-        // Bitswap every element of the underlying sequence
-        for (; it != std::next(last.base(), !is_last_aligned); ++it) {
-            *it = _bitswap(*it);
+    // Search when bits belong to the same underlying word
+    } else if (first.position() != last.position()) {
+        word = _bextr<word_type>(
+            *it ^ flip, 
+            first.position(), 
+            last.position() - first.position()
+        );
+        if (word) {
+            return bit_iterator<InputIt>(it, first.position() + _tzcnt(word));
         }
-        // Blend bits of the first element
-        if (!is_first_aligned) {
-            *first.base() = _bitblend<word_type>(
-                first_value,
-                *first.base(),
-                first.position(),
-                digits - first.position()
+    }
+    
+    // Finalization
+    return last;
+}
+
+// Finds the last bit equal to the provided bit value
+template <class BidirIt>
+constexpr bit_iterator<BidirIt> find_last(
+    bit_iterator<BidirIt> first,
+    bit_iterator<BidirIt> last,
+    bit_value value
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+    
+    // Types and constants
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<BidirIt>::word_type
+    >::type;
+    using size_type = typename bit_iterator<BidirIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    
+    // Initialization: zero bits are searched as ones in flipped words
+    const word_type flip = static_cast<bool>(value) 
+                         ? word_type() 
+                         : static_cast<word_type>(~word_type());
+    auto it = last.base();
+    word_type word = {};
+    
+    // Search when bits belong to several underlying words
+    if (first.base() != last.base()) {
+        if (last.position() != 0) {
+            word = static_cast<word_type>(
+                (*it ^ flip) << (digits - last.position())
             );
+            if (word) {
+                return bit_iterator<BidirIt>(
+                    it, 
+                    last.position() - 1 - _lzcnt(word)
+                );
+            }
         }
-        // Blend bits of the last element
-        if (!is_last_aligned) {
-            *last.base() = _bitblend<word_type>(
-                *last.base(),
-                last_value,
-                last.position(),
-                digits - last.position()
-            );
+        for (--it; it != first.base(); --it) {
+            word = *it ^ flip;
+            if (word) {
+                return bit_iterator<BidirIt>(it, digits - 1 - _lzcnt(word));
+            }
         }
-    // Reverse when bit iterators belong to the same underlying word
-    } else {
-        *it = _bitblend<word_type>(
-            *it, 
-            _bitswap<word_type>(*it >> first.position()) >> gap, 
+        word = static_cast<word_type>(
+            (*it ^ flip) >> first.position() << first.position()
+        );
+        if (word) {
+            return bit_iterator<BidirIt>(it, digits - 1 - _lzcnt(word));
+        }
+    // Search when bits belong to the same underlying word
+    } else if (first.position() != last.position()) {
+        word = static_cast<word_type>(_bextr<word_type>(
+            *it ^ flip, 
             first.position(), 
             last.position() - first.position()
+        ) << first.position());
+        if (word) {
+            return bit_iterator<BidirIt>(it, digits - 1 - _lzcnt(word));
+        }
+    }
+    
+    // Finalization
+    return last;
+}
+
+// Finds the first position where two ranges of bits differ
+template <class InputIt1, class InputIt2>
+constexpr std::pair<bit_iterator<InputIt1>, bit_iterator<InputIt2>> mismatch(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2
+)
+{
+    // Assertions
+    _assert_range_viability(first1, last1);
+    
+    // Types and constants
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<InputIt1>::word_type
+    >::type;
+    using size_type = typename bit_iterator<InputIt1>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    static_assert(std::is_same<
+        typename std::remove_cv<
+            typename bit_iterator<InputIt2>::word_type
+        >::type, word_type
+    >::value, "");
+    
+    // Initialization
+    size_type n = std::distance(first1, last1);
+    size_type pos1 = first1.position();
+    size_type pos2 = first2.position();
+    size_type cnt = 0;
+    auto it1 = first1.base();
+    auto it2 = first2.base();
+    word_type diff = 0;
+    
+    // Compares the bits of the first element of the first range if unaligned
+    if (pos1 != 0 && n != 0) {
+        cnt = std::min(n, digits - pos1);
+        diff = _bextr<word_type>(static_cast<word_type>(
+            (*it1 >> pos1) ^ _read_word(it2, pos2, cnt)
+        ), 0, cnt);
+        if (diff == 0) {
+            pos2 += cnt;
+            if (pos2 >= digits) {
+                pos2 -= digits;
+                ++it2;
+            }
+            n -= cnt;
+            pos1 = 0;
+            ++it1;
+        }
+    }
+    
+    // Skips the equal whole elements at once when both ranges are aligned
+    if (_is_contiguous_iterator<InputIt1>::value
+     && _is_contiguous_iterator<InputIt2>::value
+     && diff == 0 && pos1 == 0 && pos2 == 0 && n >= digits
+     && !_is_constant_evaluated()) {
+        const auto words = std::distance(&*it1, std::mismatch(
+            &*it1, &*it1 + n / digits, &*it2
+        ).first);
+        n -= words * digits;
+        it1 = std::next(it1, words);
+        it2 = std::next(it2, words);
+    }
+
+    // Compares whole elements of the first range until a difference is found
+    while (diff == 0 && n >= digits) {
+        diff = *it1 ^ (pos2 
+             ? _shrd<word_type>(*it2, *std::next(it2), pos2) 
+             : *it2);
+        if (diff == 0) {
+            n -= digits;
+            ++it1;
+            ++it2;
+        }
+    }
+    
+    // Compares the bits of the last element of the first range
+    if (diff == 0 && n != 0) {
+        diff = _bextr<word_type>(static_cast<word_type>(
+            *it1 ^ _read_word(it2, pos2, n)
+        ), 0, n);
+    }
+    
+    // Finalization: the first differing bit is the lowest set bit of diff
+    cnt = diff ? _tzcnt(diff) : n;
+    return std::make_pair(
+        diff ? bit_iterator<InputIt1>(it1, pos1 + cnt) : last1,
+        bit_iterator<InputIt2>(it2, pos2) + cnt
+    );
+}
+
+// Checks whether two ranges of bits are equal
+template <class InputIt1, class InputIt2>
+constexpr bool equal(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2
+)
+{
+    // Assertions
+    _assert_range_viability(first1, last1);
+    
+    // Types and constants
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<InputIt1>::word_type
+    >::type;
+    using size_type = typename bit_iterator<InputIt1>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    
+    // Initialization
+    const size_type n = std::distance(first1, last1);
+    const bool is_aligned = first1.position() == 0 && first2.position() == 0;
+    auto it1 = first1.base();
+    auto it2 = first2.base();
+    bool result = true;
+    
+    // Compares whole elements directly, with memcmp on contiguous words
+    if (is_aligned && !_is_constant_evaluated()) {
+        result = std::equal(it1, std::next(it1, n / digits), it2);
+        std::advance(it1, n / digits);
+        std::advance(it2, n / digits);
+        result = result && (n % digits == 0 || _bextr<word_type>(
+            static_cast<word_type>(*it1 ^ *it2), 0, n % digits
+        ) == 0);
+    // Compares realigned elements otherwise
+    } else {
+        result = bit::mismatch(first1, last1, first2).first == last1;
+    }
+    return result;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- MODIFYING SEQUENCE OPERATIONS ---------------------- //
+// Copies a range of bits to a range beginning at d_first
+template <class InputIt, class OutputIt>
+constexpr bit_iterator<OutputIt> copy(
+    bit_iterator<InputIt> first,
+    bit_iterator<InputIt> last,
+    bit_iterator<OutputIt> d_first
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+    
+    // Types and constants
+    using src_word_type = typename bit_iterator<InputIt>::word_type;
+    using dst_word_type = typename bit_iterator<OutputIt>::word_type;
+    using word_type = typename std::remove_cv<dst_word_type>::type;
+    using size_type = typename bit_iterator<OutputIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    static_assert(std::is_same<
+        typename std::remove_cv<src_word_type>::type, word_type
+    >::value, "");
+    
+    // Initialization
+    size_type n = std::distance(first, last);
+    size_type src_pos = first.position();
+    const size_type dst_pos = d_first.position();
+    size_type cnt = 0;
+    auto it = first.base();
+    auto d_it = d_first.base();
+    word_type src_value = {};
+    
+    // Nothing to copy
+    if (n == 0) {
+        return d_first;
+    }
+    _BIT_RECORD(
+        copy,
+        n + dst_pos <= digits ? _path::single_word
+        : src_pos == dst_pos ? _path::aligned
+        : _path::unaligned,
+        first,
+        last
+    );
+    
+    // Copy the bits of the first destination element when it is unaligned
+    if (dst_pos != 0) {
+        cnt = std::min(n, digits - dst_pos);
+        src_value = _read_word(it, src_pos, cnt);
+        *d_it = _bitblend<word_type>(*d_it, src_value << dst_pos, dst_pos, cnt);
+        if (dst_pos + cnt < digits) {
+            return bit_iterator<OutputIt>(d_it, dst_pos + cnt);
+        }
+        src_pos += cnt;
+        if (src_pos >= digits) {
+            src_pos -= digits;
+            ++it;
+        }
+        n -= cnt;
+        ++d_it;
+    }
+    
+    // Copy whole destination elements: memmove when source is aligned
+    if (src_pos == 0 && !_is_constant_evaluated()) {
+        cnt = n / digits;
+        d_it = std::copy(it, std::next(it, cnt), d_it);
+        it = std::next(it, cnt);
+        n -= cnt * digits;
+    // Copy whole destination elements: word loop in constant expressions
+    } else if (src_pos == 0) {
+        for (; n >= digits; n -= digits) {
+            *d_it = *it;
+            ++d_it;
+            ++it;
+        }
+    // Copy whole destination elements: realign source elements
+    } else {
+        for (; n >= digits; n -= digits) {
+            *d_it = _shrd<word_type>(*it, *std::next(it), src_pos);
+            ++d_it;
+            ++it;
+        }
+    }
+    
+    // Copy the bits of the last destination element
+    if (n != 0) {
+        src_value = _read_word(it, src_pos, n);
+        *d_it = _bitblend<word_type>(*d_it, src_value, 0, n);
+    }
+    
+    // Finalization
+    return bit_iterator<OutputIt>(d_it, n);
+}
+
+// Copies count bits to a range beginning at d_first
+template <class InputIt, class Size, class OutputIt>
+constexpr bit_iterator<OutputIt> copy_n(
+    bit_iterator<InputIt> first,
+    Size count,
+    bit_iterator<OutputIt> d_first
+)
+{
+    return count > 0 
+         ? bit::copy(first, std::next(first, count), d_first) 
+         : d_first;
+}
+
+// Copies a range of bits to a range ending at d_last, starting from the end
+template <class BidirIt1, class BidirIt2>
+constexpr bit_iterator<BidirIt2> copy_backward(
+    bit_iterator<BidirIt1> first,
+    bit_iterator<BidirIt1> last,
+    bit_iterator<BidirIt2> d_last
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+    
+    // Types and constants
+    using src_word_type = typename bit_iterator<BidirIt1>::word_type;
+    using dst_word_type = typename bit_iterator<BidirIt2>::word_type;
+    using word_type = typename std::remove_cv<dst_word_type>::type;
+    using size_type = typename bit_iterator<BidirIt2>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    static_assert(std::is_same<
+        typename std::remove_cv<src_word_type>::type, word_type
+    >::value, "");
+    
+    // Initialization
+    size_type n = std::distance(first, last);
+    size_type src_pos = last.position();
+    const size_type dst_pos = d_last.position();
+    size_type cnt = 0;
+    auto it = last.base();
+    auto d_it = d_last.base();
+    word_type src_value = {};
+    
+    // Nothing to copy
+    if (n == 0) {
+        return d_last;
+    }
+    
+    // Copy the bits of the last destination element when it is unaligned
+    if (dst_pos != 0) {
+        cnt = std::min(n, dst_pos);
+        if (cnt <= src_pos) {
+            src_pos -= cnt;
+        } else {
+            src_pos += digits - cnt;
+            --it;
+        }
+        src_value = _read_word(it, src_pos, cnt);
+        *d_it = _bitblend<word_type>(
+            *d_it, 
+            src_value << (dst_pos - cnt), 
+            dst_pos - cnt, 
+            cnt
+        );
+        if (cnt < dst_pos) {
+            return bit_iterator<BidirIt2>(d_it, dst_pos - cnt);
+        }
+        n -= cnt;
+    }
+    
+    // Copy whole destination elements: memmove when source is aligned
+    if (src_pos == 0 && !_is_constant_evaluated()) {
+        cnt = n / digits;
+        d_it = std::copy_backward(std::prev(it, cnt), it, d_it);
+        it = std::prev(it, cnt);
+        n -= cnt * digits;
+    // Copy whole destination elements: word loop in constant expressions
+    } else if (src_pos == 0) {
+        for (; n >= digits; n -= digits) {
+            --d_it;
+            --it;
+            *d_it = *it;
+        }
+    // Copy whole destination elements: realign source elements
+    } else {
+        for (; n >= digits; n -= digits) {
+            --d_it;
+            --it;
+            *d_it = _shrd<word_type>(*it, *std::next(it), src_pos);
+        }
+    }
+    
+    // Copy the bits of the first destination element
+    if (n != 0) {
+        if (n <= src_pos) {
+            src_pos -= n;
+        } else {
+            src_pos += digits - n;
+            --it;
+        }
+        src_value = _read_word(it, src_pos, n);
+        --d_it;
+        *d_it = _bitblend<word_type>(
+            *d_it, 
+            src_value << (digits - n), 
+            digits - n, 
+            n
+        );
+        n = digits - n;
+    }
+    
+    // Finalization
+    return bit_iterator<BidirIt2>(d_it, n);
+}
+
+// Applies a bitwise word operation to a range and stores the result
+template <class InputIt, class OutputIt, class UnaryOperation>
+constexpr bit_iterator<OutputIt> transform(
+    bit_iterator<InputIt> first,
+    bit_iterator<InputIt> last,
+    bit_iterator<OutputIt> d_first,
+    UnaryOperation unary_op
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+    
+    // Types and constants
+    using src_word_type = typename bit_iterator<InputIt>::word_type;
+    using dst_word_type = typename bit_iterator<OutputIt>::word_type;
+    using word_type = typename std::remove_cv<dst_word_type>::type;
+    using size_type = typename bit_iterator<OutputIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    static_assert(std::is_same<
+        typename std::remove_cv<src_word_type>::type, word_type
+    >::value, "");
+    
+    // Initialization
+    size_type n = std::distance(first, last);
+    size_type src_pos = first.position();
+    const size_type dst_pos = d_first.position();
+    size_type cnt = 0;
+    auto it = first.base();
+    auto d_it = d_first.base();
+    word_type dst_value = {};
+    
+    // Nothing to transform
+    if (n == 0) {
+        return d_first;
+    }
+    
+    // Transforms the bits of the first destination element when unaligned
+    if (dst_pos != 0) {
+        cnt = std::min(n, digits - dst_pos);
+        dst_value = unary_op(_read_word(it, src_pos, cnt));
+        *d_it = _bitblend<word_type>(*d_it, dst_value << dst_pos, dst_pos, cnt);
+        if (dst_pos + cnt < digits) {
+            return bit_iterator<OutputIt>(d_it, dst_pos + cnt);
+        }
+        src_pos += cnt;
+        if (src_pos >= digits) {
+            src_pos -= digits;
+            ++it;
+        }
+        n -= cnt;
+        ++d_it;
+    }
+    
+    // Transforms whole destination elements: vectorizable aligned loop
+    if (src_pos == 0 && !_is_constant_evaluated()) {
+        cnt = n / digits;
+        d_it = std::transform(it, std::next(it, cnt), d_it, unary_op);
+        it = std::next(it, cnt);
+        n -= cnt * digits;
+    // Transforms whole destination elements: word loop in constant expressions
+    } else if (src_pos == 0) {
+        for (; n >= digits; n -= digits) {
+            *d_it = unary_op(*it);
+            ++d_it;
+            ++it;
+        }
+    // Transforms whole destination elements: realign source elements
+    } else {
+        for (; n >= digits; n -= digits) {
+            *d_it = unary_op(_shrd<word_type>(*it, *std::next(it), src_pos));
+            ++d_it;
+            ++it;
+        }
+    }
+    
+    // Transforms the bits of the last destination element
+    if (n != 0) {
+        dst_value = unary_op(_read_word(it, src_pos, n));
+        *d_it = _bitblend<word_type>(*d_it, dst_value, 0, n);
+    }
+    
+    // Finalization
+    return bit_iterator<OutputIt>(d_it, n);
+}
+
+// Applies a bitwise word operation to two ranges and stores the result
+template <class InputIt1, class InputIt2, class OutputIt, class BinaryOperation>
+constexpr bit_iterator<OutputIt> transform(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2,
+    bit_iterator<OutputIt> d_first,
+    BinaryOperation binary_op
+)
+{
+    // Assertions
+    _assert_range_viability(first1, last1);
+    
+    // Types and constants
+    using src1_word_type = typename bit_iterator<InputIt1>::word_type;
+    using src2_word_type = typename bit_iterator<InputIt2>::word_type;
+    using dst_word_type = typename bit_iterator<OutputIt>::word_type;
+    using word_type = typename std::remove_cv<dst_word_type>::type;
+    using size_type = typename bit_iterator<OutputIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    static_assert(std::is_same<
+        typename std::remove_cv<src1_word_type>::type, word_type
+    >::value, "");
+    static_assert(std::is_same<
+        typename std::remove_cv<src2_word_type>::type, word_type
+    >::value, "");
+    
+    // Initialization
+    size_type n = std::distance(first1, last1);
+    size_type pos1 = first1.position();
+    size_type pos2 = first2.position();
+    const size_type dst_pos = d_first.position();
+    size_type cnt = 0;
+    auto it1 = first1.base();
+    auto it2 = first2.base();
+    auto d_it = d_first.base();
+    word_type dst_value = {};
+    
+    // Nothing to transform
+    if (n == 0) {
+        return d_first;
+    }
+    
+    // Transforms the bits of the first destination element when unaligned
+    if (dst_pos != 0) {
+        cnt = std::min(n, digits - dst_pos);
+        dst_value = binary_op(
+            _read_word(it1, pos1, cnt), 
+            _read_word(it2, pos2, cnt)
+        );
+        *d_it = _bitblend<word_type>(*d_it, dst_value << dst_pos, dst_pos, cnt);
+        if (dst_pos + cnt < digits) {
+            return bit_iterator<OutputIt>(d_it, dst_pos + cnt);
+        }
+        pos1 += cnt;
+        if (pos1 >= digits) {
+            pos1 -= digits;
+            ++it1;
+        }
+        pos2 += cnt;
+        if (pos2 >= digits) {
+            pos2 -= digits;
+            ++it2;
+        }
+        n -= cnt;
+        ++d_it;
+    }
+    
+    // Transforms whole destination elements: vectorizable aligned loop
+    if (pos1 == 0 && pos2 == 0 && !_is_constant_evaluated()) {
+        cnt = n / digits;
+        d_it = std::transform(it1, std::next(it1, cnt), it2, d_it, binary_op);
+        it1 = std::next(it1, cnt);
+        it2 = std::next(it2, cnt);
+        n -= cnt * digits;
+    // Transforms whole destination elements: realign source elements
+    } else {
+        for (; n >= digits; n -= digits) {
+            *d_it = binary_op(
+                pos1 ? _shrd<word_type>(*it1, *std::next(it1), pos1) : *it1,
+                pos2 ? _shrd<word_type>(*it2, *std::next(it2), pos2) : *it2
+            );
+            ++d_it;
+            ++it1;
+            ++it2;
+        }
+    }
+    
+    // Transforms the bits of the last destination element
+    if (n != 0) {
+        dst_value = binary_op(
+            _read_word(it1, pos1, n), 
+            _read_word(it2, pos2, n)
+        );
+        *d_it = _bitblend<word_type>(*d_it, dst_value, 0, n);
+    }
+    
+    // Finalization
+    return bit_iterator<OutputIt>(d_it, n);
+}
+
+// Assigns the provided bit value to every bit of the range
+template <class ForwardIt>
+constexpr void fill(
+    bit_iterator<ForwardIt> first,
+    bit_iterator<ForwardIt> last,
+    bit_value value
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+    
+    // Types and constants
+    using word_type = typename bit_iterator<ForwardIt>::word_type;
+    using size_type = typename bit_iterator<ForwardIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    
+    // Initialization
+    const word_type fill_value = static_cast<bool>(value) 
+                               ? static_cast<word_type>(~word_type())
+                               : word_type();
+    auto it = first.base();
+    _BIT_RECORD(fill, _range_path(first, last), first, last);
+    
+    // Filling when bits belong to several underlying words
+    if (first.base() != last.base()) {
+        if (first.position() != 0) {
+            *it = _bitblend<word_type>(
+                *it, 
+                fill_value, 
+                first.position(), 
+                digits - first.position()
+            );
+            ++it;
+        }
+        if (_is_constant_evaluated()) {
+            for (; it != last.base(); ++it) {
+                *it = fill_value;
+            }
+        } else {
+            std::fill(it, last.base(), fill_value);
+        }
+        if (last.position() != 0) {
+            *last.base() = _bitblend<word_type>(
+                *last.base(), 
+                fill_value, 
+                0, 
+                last.position()
+            );
+        }
+    // Filling when bits belong to the same underlying word
+    } else if (first.position() != last.position()) {
+        *it = _bitblend<word_type>(
+            *it, 
+            fill_value, 
+            first.position(), 
+            last.position() - first.position()
+        );
+    }
+}
+
+// Assigns the provided bit value to the count first bits of the range
+template <class OutputIt, class Size>
+constexpr bit_iterator<OutputIt> fill_n(
+    bit_iterator<OutputIt> first,
+    Size count,
+    bit_value value
+)
+{
+    bit_iterator<OutputIt> last = first;
+    if (count > 0) {
+        last = std::next(first, count);
+        bit::fill(first, last, value);
+    }
+    return last;
+}
+
+// Assigns the successive results of the generator to the bits of the range
+template <class ForwardIt, class Generator>
+constexpr void generate(
+    bit_iterator<ForwardIt> first,
+    bit_iterator<ForwardIt> last,
+    Generator g
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+    
+    // Types and constants
+    using word_type = typename bit_iterator<ForwardIt>::word_type;
+    using size_type = typename bit_iterator<ForwardIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    
+    // Initialization
+    const size_type last_pos = first.base() != last.base() 
+                             ? digits 
+                             : last.position();
+    size_type pos = first.position();
+    auto it = first.base();
+    word_type value = {};
+    
+    // Generation of the bits of the first underlying word if partial
+    if ((pos != 0 || first.base() == last.base()) && pos < last_pos) {
+        for (value = word_type(); pos < last_pos; ++pos) {
+            value |= static_cast<word_type>(static_cast<bool>(g())) << pos;
+        }
+        *it = _bitblend<word_type>(
+            *it, 
+            value, 
+            first.position(), 
+            last_pos - first.position()
+        );
+        ++it;
+    }
+    
+    // Generation of the bits of the other underlying words
+    if (first.base() != last.base()) {
+        for (; it != last.base(); ++it) {
+            value = word_type();
+            for (pos = 0; pos < digits; ++pos) {
+                value |= static_cast<word_type>(static_cast<bool>(g())) << pos;
+            }
+            *it = value;
+        }
+        if (last.position() != 0) {
+            value = word_type();
+            for (pos = 0; pos < last.position(); ++pos) {
+                value |= static_cast<word_type>(static_cast<bool>(g())) << pos;
+            }
+            *it = _bitblend<word_type>(*it, value, 0, last.position());
+        }
+    }
+}
+
+// Reverses the order of the bits in the provided range
+template <class BidirIt> 
+constexpr void reverse(
+    bit_iterator<BidirIt> first, 
+    bit_iterator<BidirIt> last
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+    
+    // Types and constants
+    using word_type = typename bit_iterator<BidirIt>::word_type;
+    using size_type = typename bit_iterator<BidirIt>::size_type;
+    using difference_type = typename bit_iterator<BidirIt>::difference_type;
+    using segmented_type = typename segmented_iterator_traits<
+        BidirIt
+    >::is_segmented_iterator;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr difference_type double_digits = digits + digits;
+    
+    // Initialization
+    const bool is_first_aligned = first.position() == 0;
+    const bool is_last_aligned = last.position() == 0;
+    auto it = first.base();
+    auto lit = last.base();
+    size_type pos = first.position();
+    size_type lpos = last.position();
+    size_type len = 0;
+    difference_type n = std::distance(first.base(), last.base()) * digits;
+    word_type value = {};
+    word_type lo = {};
+    word_type hi = {};
+    n = n + last.position() - first.position();
+
+    // Swaps len bits at it and pos with the len bits ending at lit and lpos
+    const auto swap_bits = [](
+        BidirIt it, 
+        size_type pos, 
+        BidirIt& lit, 
+        size_type& lpos, 
+        size_type len
+    ){
+        lit = lpos >= len ? lit : std::prev(lit);
+        lpos = lpos >= len ? lpos - len : lpos + digits - len;
+        const word_type src0 = _bitswap(_read_word(it, pos, len));
+        const word_type src1 = _bitswap(_read_word(lit, lpos, len));
+        _write_word(it, pos, len, src1 >> (digits - len));
+        _write_word(lit, lpos, len, src0 >> (digits - len));
+    };
+    
+    // Reverse segment by segment when the range is segmented
+    if (segmented_type::value) {
+        _reverse_segments(first, last, segmented_type());
+    // Reverse when bit iterators are aligned
+    } else if (is_first_aligned && is_last_aligned) {
+        _BIT_RECORD(reverse, _path::aligned, first, last);
+        if (_is_constant_evaluated()) {
+            for (lit = last.base(); it != lit && it != --lit; ++it) {
+                value = *it;
+                *it = *lit;
+                *lit = value;
+            }
+            it = first.base();
+        } else {
+            std::reverse(first.base(), last.base());
+        }
+        if (_is_contiguous_iterator<BidirIt>::value && it != last.base()
+         && !_is_constant_evaluated()) {
+            _vbitswap(&*it, &*it + std::distance(it, last.base()));
+            it = last.base();
+        }
+        for (; it !=  last.base(); ++it) {
+            *it = _bitswap(*it);
+        }
+    // Reverse in registers when the range is at most one word long
+    } else if (n <= static_cast<difference_type>(digits)) {
+        _BIT_RECORD(reverse, _path::single_word, first, last);
+        if (n > 0) {
+            value = _bitswap(_read_word(it, pos, n));
+            _write_word(it, pos, n, value >> (digits - n));
+        }
+    // Reverse by swapping bits from both ends of the range in a single pass
+    } else {
+        _BIT_RECORD(reverse, _path::unaligned, first, last);
+        // Swap the bits before the first full word with the last bits
+        len = (digits - pos) * !is_first_aligned;
+        if (len && n >= static_cast<difference_type>(len + len)) {
+            swap_bits(it, pos, lit, lpos, len);
+            n -= static_cast<difference_type>(len + len);
+            pos = 0;
+            ++it;
+        }
+        // Swap full words with the last bits in a single pass
+        if (lpos == 0) {
+            for (; n >= double_digits; ++it) {
+                lit = std::prev(lit);
+                value = *lit;
+                *lit = _bitswap(*it);
+                *it = _bitswap(value);
+                n -= double_digits;
+            }
+        } else {
+            hi = *lit;
+            for (; n >= double_digits; ++it) {
+                lo = *std::prev(lit);
+                value = _bitswap(*it);
+                *it = _bitswap(_shrd<word_type>(lo, hi, lpos));
+                *lit = _bitblend<word_type>(
+                    hi, value >> (digits - lpos), 0, lpos
+                );
+                hi = _bitblend<word_type>(
+                    lo, value << lpos, lpos, digits - lpos
+                );
+                lit = std::prev(lit);
+                n -= double_digits;
+            }
+            *lit = hi;
+        }
+        // Swap the remaining bits in the middle
+        len = n / 2;
+        if (len) {
+            swap_bits(it, pos, lit, lpos, len);
+        }
+    }
+}
+
+// Rotates the bits of the range so that n_first becomes the first bit
+template <class BidirIt>
+constexpr bit_iterator<BidirIt> rotate(
+    bit_iterator<BidirIt> first,
+    bit_iterator<BidirIt> n_first,
+    bit_iterator<BidirIt> last
+)
+{
+    // Assertions
+    _assert_range_viability(first, n_first);
+    _assert_range_viability(n_first, last);
+    
+    // Types and constants
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<BidirIt>::word_type
+    >::type;
+    using size_type = typename bit_iterator<BidirIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr size_type words = 256 / sizeof(word_type);
+    constexpr size_type capacity = words * digits;
+    
+    // Initialization
+    const size_type n = std::distance(first, n_first);
+    const size_type m = std::distance(n_first, last);
+    word_type buffer[words] = {};
+    bit_iterator<word_type*> buffer_first(buffer);
+    bit_iterator<BidirIt> result = last;
+    
+    // Nothing to rotate
+    if (n == 0 || m == 0) {
+        result = n == 0 ? last : first;
+    // Buffer the short left part and shift the right part word by word
+    } else if (n <= capacity) {
+        bit::copy(first, n_first, buffer_first);
+        result = bit::copy(n_first, last, first);
+        bit::copy(buffer_first, std::next(buffer_first, n), result);
+    // Buffer the short right part and shift the left part word by word
+    } else if (m <= capacity) {
+        bit::copy(n_first, last, buffer_first);
+        bit::copy_backward(first, n_first, last);
+        result = bit::copy(buffer_first, std::next(buffer_first, m), first);
+    // Rotate long parts in place through three reversals
+    } else {
+        bit::reverse(first, n_first);
+        bit::reverse(n_first, last);
+        bit::reverse(first, last);
+        result = std::next(first, m);
+    }
+    return result;
+}
+
+// Shifts the bits of the range by n positions towards its beginning
+template <class ForwardIt>
+constexpr bit_iterator<ForwardIt> shift_left(
+    bit_iterator<ForwardIt> first,
+    bit_iterator<ForwardIt> last,
+    typename bit_iterator<ForwardIt>::difference_type n
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+    
+    // Initialization
+    const auto count = std::distance(first, last);
+    
+    // Shifts whole words and blends the boundaries through copy
+    return n <= 0 ? last
+         : n >= count ? first
+         : bit::copy(std::next(first, n), last, first);
+}
+
+// Shifts the bits of the range by n positions towards its end
+template <class BidirIt>
+constexpr bit_iterator<BidirIt> shift_right(
+    bit_iterator<BidirIt> first,
+    bit_iterator<BidirIt> last,
+    typename bit_iterator<BidirIt>::difference_type n
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+    
+    // Initialization
+    const auto count = std::distance(first, last);
+    
+    // Shifts whole words and blends the boundaries through copy_backward
+    return n <= 0 ? first
+         : n >= count ? last
+         : bit::copy_backward(first, std::prev(last, n), last);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- COMPARISON OPERATIONS -------------------------- //
+// Checks whether the first range of bits is lexicographically less
+template <class InputIt1, class InputIt2>
+constexpr bool lexicographical_compare(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2,
+    bit_iterator<InputIt2> last2
+)
+{
+    // Assertions
+    _assert_range_viability(first1, last1);
+    _assert_range_viability(first2, last2);
+    
+    // Initialization
+    const auto n1 = std::distance(first1, last1);
+    const auto n2 = std::distance(first2, last2);
+    bool result = false;
+    
+    // Compares up to the end of the shortest range, a zero being the smallest
+    if (n1 <= n2) {
+        const auto positions = bit::mismatch(first1, last1, first2);
+        result = positions.first == last1
+               ? n1 < n2
+               : !static_cast<bool>(*positions.first);
+    } else {
+        const auto positions = bit::mismatch(first2, last2, first1);
+        result = positions.first != last2 
+              && static_cast<bool>(*positions.first);
+    }
+    return result;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- SELECTION OPERATIONS -------------------------- //
+// Copies the bits selected by a mask densely to a range beginning at d_first
+template <class InputIt1, class InputIt2, class OutputIt>
+constexpr bit_iterator<OutputIt> pack(
+    bit_iterator<InputIt1> first,
+    bit_iterator<InputIt1> last,
+    bit_iterator<InputIt2> mask_first,
+    bit_iterator<OutputIt> d_first
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+
+    // Types and constants
+    using src_word_type = typename bit_iterator<InputIt1>::word_type;
+    using msk_word_type = typename bit_iterator<InputIt2>::word_type;
+    using dst_word_type = typename bit_iterator<OutputIt>::word_type;
+    using word_type = typename std::remove_cv<dst_word_type>::type;
+    using size_type = typename bit_iterator<OutputIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    static_assert(std::is_same<
+        typename std::remove_cv<src_word_type>::type, word_type
+    >::value, "");
+    static_assert(std::is_same<
+        typename std::remove_cv<msk_word_type>::type, word_type
+    >::value, "");
+
+    // Initialization
+    size_type n = std::distance(first, last);
+    const size_type pos = first.position();
+    const size_type msk_pos = mask_first.position();
+    size_type d_pos = d_first.position();
+    size_type len = 0;
+    size_type cnt = 0;
+    auto it = first.base();
+    auto msk_it = mask_first.base();
+    auto d_it = d_first.base();
+    word_type value = 0;
+    word_type msk = 0;
+
+    // Extract the selected bits of each word and append them to the output
+    for (; n != 0; n -= len) {
+        len = std::min(n, digits);
+        msk = _bextr<word_type>(_read_word(msk_it, msk_pos, len), 0, len);
+        cnt = _popcnt(msk);
+        if (cnt != 0) {
+            value = _pext(_read_word(it, pos, len), msk);
+            _write_word(d_it, d_pos, cnt, value);
+            d_pos += cnt;
+            if (d_pos >= digits) {
+                d_pos -= digits;
+                ++d_it;
+            }
+        }
+        ++it;
+        ++msk_it;
+    }
+    return bit_iterator<OutputIt>(d_it, d_pos);
+}
+
+// Spreads densely packed bits to the positions selected by a mask
+template <class InputIt1, class InputIt2, class OutputIt>
+constexpr bit_iterator<OutputIt> unpack(
+    bit_iterator<InputIt1> mask_first,
+    bit_iterator<InputIt1> mask_last,
+    bit_iterator<InputIt2> first,
+    bit_iterator<OutputIt> d_first
+)
+{
+    // Assertions
+    _assert_range_viability(mask_first, mask_last);
+
+    // Types and constants
+    using msk_word_type = typename bit_iterator<InputIt1>::word_type;
+    using src_word_type = typename bit_iterator<InputIt2>::word_type;
+    using dst_word_type = typename bit_iterator<OutputIt>::word_type;
+    using word_type = typename std::remove_cv<dst_word_type>::type;
+    using size_type = typename bit_iterator<OutputIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    static_assert(std::is_same<
+        typename std::remove_cv<src_word_type>::type, word_type
+    >::value, "");
+    static_assert(std::is_same<
+        typename std::remove_cv<msk_word_type>::type, word_type
+    >::value, "");
+
+    // Initialization
+    const size_type size = std::distance(mask_first, mask_last);
+    const size_type msk_pos = mask_first.position();
+    const size_type d_pos = d_first.position();
+    size_type n = size;
+    size_type pos = first.position();
+    size_type len = 0;
+    size_type cnt = 0;
+    auto msk_it = mask_first.base();
+    auto it = first.base();
+    auto d_it = d_first.base();
+    word_type value = 0;
+    word_type msk = 0;
+
+    // Deposit the next packed bits of each word, clearing the unselected ones
+    for (; n != 0; n -= len) {
+        len = std::min(n, digits);
+        msk = _bextr<word_type>(_read_word(msk_it, msk_pos, len), 0, len);
+        cnt = _popcnt(msk);
+        value = cnt != 0 ? _read_word(it, pos, cnt) : 0;
+        _write_word(d_it, d_pos, len, _pdep(value, msk));
+        pos += cnt;
+        if (pos >= digits) {
+            pos -= digits;
+            ++it;
+        }
+        ++msk_it;
+        ++d_it;
+    }
+    return std::next(d_first, size);
+}
+
+// Copies the elements selected by a mask to a range beginning at d_first
+template <class RandomIt, class InputIt, class OutputIt>
+constexpr OutputIt gather(
+    RandomIt first,
+    RandomIt last,
+    bit_iterator<InputIt> mask_first,
+    OutputIt d_first
+)
+{
+    // Types and constants
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<InputIt>::word_type
+    >::type;
+    using size_type = typename bit_iterator<InputIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    const size_type n = std::distance(first, last);
+    const size_type msk_pos = mask_first.position();
+    size_type len = 0;
+    auto msk_it = mask_first.base();
+    word_type msk = 0;
+
+    // Visit the selected elements of each word with tzcnt instead of testing
+    for (size_type i = 0; i < n; i += len) {
+        len = std::min(n - i, digits);
+        msk = _bextr<word_type>(_read_word(msk_it, msk_pos, len), 0, len);
+        for (; msk != 0; msk &= msk - 1) {
+            *d_first = first[i + _tzcnt(msk)];
+            ++d_first;
+        }
+        ++msk_it;
+    }
+    return d_first;
+}
+
+// Adds to init the elements selected by a mask, in order
+template <class RandomIt, class InputIt, class T>
+constexpr T masked_sum(
+    RandomIt first,
+    RandomIt last,
+    bit_iterator<InputIt> mask_first,
+    T init
+)
+{
+    // Types and constants
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<InputIt>::word_type
+    >::type;
+    using size_type = typename bit_iterator<InputIt>::size_type;
+    using chunk_type = typename std::conditional<
+        (binary_digits<word_type>::value < binary_digits<std::uint64_t>::value),
+        std::uint64_t,
+        word_type
+    >::type;
+    constexpr size_type digits = binary_digits<chunk_type>::value;
+    constexpr size_type density = 4;
+
+    // Initialization
+    const size_type n = std::distance(first, last);
+    const size_type msk_pos = mask_first.position();
+    size_type len = 0;
+    auto msk_it = mask_first.base();
+    chunk_type msk = 0;
+
+    // Adds the elements of dense chunks with a branchless loop that can be
+    // vectorized, and visits those of sparse chunks with tzcnt and blsr
+    for (size_type i = 0; i < n; i += len) {
+        len = std::min(n - i, digits);
+        msk = _read_chunk<chunk_type>(msk_it, msk_pos, len);
+        if (len == digits && _popcnt(msk) > digits / density) {
+            for (size_type j = 0; j < digits; ++j) {
+                init = init + ((msk >> j) & 1 ? first[i + j] : T());
+            }
+        } else {
+            for (; msk != 0; msk &= msk - 1) {
+                init = init + first[i + _tzcnt(msk)];
+            }
+        }
+    }
+    return init;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- IMPLEMENTATION DETAILS: REVERSAL -------------------- //
+// Swaps the bits of a range with the bits ending at d_last in reverse order,
+// reading and writing each word of both sides once in a single pass
+template <class BidirIt>
+void _reverse_swap(
+    bit_iterator<BidirIt> first,
+    bit_iterator<BidirIt> last,
+    bit_iterator<BidirIt> d_last
+)
+{
+    // Types and constants
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<BidirIt>::word_type
+    >::type;
+    using size_type = typename bit_iterator<BidirIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    size_type n = std::distance(first, last);
+    size_type pos = first.position();
+    size_type lpos = d_last.position();
+    size_type len = 0;
+    auto it = first.base();
+    auto lit = d_last.base();
+    word_type value = {};
+    word_type lo = {};
+    word_type hi = {};
+
+    // Swaps len bits at it and pos with the len bits ending at lit and lpos
+    const auto swap_bits = [&it, &pos, &lit, &lpos](size_type len){
+        lit = lpos >= len ? lit : std::prev(lit);
+        lpos = lpos >= len ? lpos - len : lpos + digits - len;
+        const word_type src0 = _bitswap(_read_word(it, pos, len));
+        const word_type src1 = _bitswap(_read_word(lit, lpos, len));
+        _write_word(it, pos, len, static_cast<word_type>(
+            src1 >> (digits - len)
+        ));
+        _write_word(lit, lpos, len, static_cast<word_type>(
+            src0 >> (digits - len)
+        ));
+        pos += len;
+        it = pos >= digits ? std::next(it) : it;
+        pos = pos >= digits ? pos - digits : pos;
+    };
+
+    // Swaps the bits before the first full word of the front
+    if (pos != 0 && n >= digits - pos) {
+        len = digits - pos;
+        swap_bits(len);
+        n -= len;
+    }
+
+    // Swaps full words in registers when both sides are aligned
+    if (pos == 0 && lpos == 0) {
+        for (; n >= digits; ++it) {
+            lit = std::prev(lit);
+            value = *lit;
+            *lit = _bitswap(*it);
+            *it = _bitswap(value);
+            n -= digits;
+        }
+    // Swaps full words in registers, realigning the back on the fly
+    } else if (pos == 0 && n >= digits) {
+        hi = *lit;
+        for (; n >= digits; ++it) {
+            lo = *std::prev(lit);
+            value = _bitswap(*it);
+            *it = _bitswap(_shrd<word_type>(lo, hi, lpos));
+            *lit = _bitblend<word_type>(
+                hi, value >> (digits - lpos), 0, lpos
+            );
+            hi = _bitblend<word_type>(
+                lo, value << lpos, lpos, digits - lpos
+            );
+            lit = std::prev(lit);
+            n -= digits;
+        }
+        *lit = hi;
+    }
+
+    // Swaps the remaining bits
+    for (; n != 0; n -= len) {
+        len = std::min(n, digits);
+        swap_bits(len);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------- IMPLEMENTATION DETAILS: SEGMENTED EXECUTION --------------- //
+// Calls a function on the subrange of each contiguous segment of a range,
+// through bit iterators on the local iterators of the segments
+template <class Iterator, class Function>
+void _for_each_segment(
+    bit_iterator<Iterator> first,
+    bit_iterator<Iterator> last,
+    Function f,
+    std::true_type
+)
+{
+    // Types
+    using traits = segmented_iterator_traits<Iterator>;
+    using local_iterator = bit_iterator<typename traits::local_iterator>;
+
+    // Initialization
+    auto segment = traits::segment(first.base());
+    const auto last_segment = traits::segment(last.base());
+    const local_iterator local(traits::local(first.base()), first.position());
+    const local_iterator local_last(
+        traits::local(last.base()),
+        last.position()
+    );
+
+    // Process the first, the full and the last segments
+    if (segment == last_segment) {
+        f(local, local_last);
+    } else {
+        f(local, local_iterator(traits::end(segment)));
+        for (++segment; segment != last_segment; ++segment) {
+            f(
+                local_iterator(traits::begin(segment)),
+                local_iterator(traits::end(segment))
+            );
+        }
+        f(local_iterator(traits::begin(last_segment)), local_last);
+    }
+}
+
+// Does nothing for flat iterators
+template <class Iterator, class Function>
+void _for_each_segment(
+    bit_iterator<Iterator>,
+    bit_iterator<Iterator>,
+    Function,
+    std::false_type
+) noexcept
+{
+}
+
+// Reverses a segmented range by swapping the mirrored chunks at both ends of
+// the range directly across their segments, one word at a time
+template <class BidirIt>
+void _reverse_segments(
+    bit_iterator<BidirIt> first,
+    bit_iterator<BidirIt> last,
+    std::true_type
+)
+{
+    // Types and constants
+    using traits = segmented_iterator_traits<BidirIt>;
+    using local_iterator = bit_iterator<typename traits::local_iterator>;
+    using size_type = typename bit_iterator<BidirIt>::size_type;
+
+    // Initialization
+    auto segment = traits::segment(first.base());
+    auto last_segment = traits::segment(last.base());
+    local_iterator it(traits::local(first.base()), first.position());
+    local_iterator lit(traits::local(last.base()), last.position());
+    size_type n = std::distance(first, last);
+    size_type len = 0;
+
+    // Swap the mirrored chunks at both ends until they meet in the middle
+    while (n > 1) {
+        if (it == local_iterator(traits::end(segment))) {
+            it = local_iterator(traits::begin(++segment));
+        } else if (lit == local_iterator(traits::begin(last_segment))) {
+            lit = local_iterator(traits::end(--last_segment));
+        } else {
+            len = std::min(
+                std::min<size_type>(
+                    std::distance(it, local_iterator(traits::end(segment))),
+                    std::distance(
+                        local_iterator(traits::begin(last_segment)),
+                        lit
+                    )
+                ),
+                n / 2
+            );
+            _reverse_swap(it, it + len, lit);
+            it += len;
+            lit -= len;
+            n -= len + len;
+        }
+    }
+}
+
+// Does nothing for flat iterators
+template <class BidirIt>
+void _reverse_segments(
+    bit_iterator<BidirIt>,
+    bit_iterator<BidirIt>,
+    std::false_type
+) noexcept
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------- IMPLEMENTATION DETAILS: PARALLEL EXECUTION --------------- //
+#if defined(_BIT_EXECUTION_POLICIES)
+// Number of chunks a range of words is split into for the execution policy
+template <class ExecutionPolicy, class Size>
+Size _parallel_chunks(Size words)
+{
+    // Types and constants
+    using policy_type = typename std::decay<ExecutionPolicy>::type;
+    using par_t = std::execution::parallel_policy;
+    using par_unseq_t = std::execution::parallel_unsequenced_policy;
+    constexpr Size grain = Size(1) << 16;
+    constexpr bool is_parallel = std::is_same<policy_type, par_t>::value
+                              || std::is_same<policy_type, par_unseq_t>::value;
+
+    // Initialization
+    const Size threads = std::thread::hardware_concurrency();
+    const Size chunks = std::min(threads, words / grain);
+    return is_parallel && chunks > 1 ? chunks : 1;
+}
+
+// Offsets splitting n bits into chunks starting on word boundaries from pos
+template <class Size>
+std::vector<Size> _parallel_split(Size n, Size chunks, Size pos, Size digits)
+{
+    std::vector<Size> dst(chunks + 1, n);
+    dst.front() = 0;
+    for (Size k = 1; k < chunks; ++k) {
+        dst[k] = (pos + n / chunks * k) / digits * digits;
+        dst[k] = std::max(dst[k], pos + dst[k - 1]) - pos;
+    }
+    return dst;
+}
+#endif
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- PARALLEL ALGORITHMS --------------------------- //
+#if defined(_BIT_EXECUTION_POLICIES)
+// Counts the number of bits equal to the provided bit value in parallel
+template <class ExecutionPolicy, class RandomIt>
+_enable_if_execution_policy_t<
+    ExecutionPolicy, 
+    typename bit_iterator<RandomIt>::difference_type
+> count(
+    ExecutionPolicy&&,
+    bit_iterator<RandomIt> first, 
+    bit_iterator<RandomIt> last, 
+    bit_value value
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+
+    // Types and constants
+    using word_type = typename bit_iterator<RandomIt>::word_type;
+    using difference_type = typename bit_iterator<RandomIt>::difference_type;
+    using future_type = std::future<difference_type>;
+    constexpr difference_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    const difference_type n = last - first;
+    const difference_type pos = first.position();
+    const difference_type words = n / digits;
+    const difference_type chunks = _parallel_chunks<ExecutionPolicy>(words);
+    const auto offsets = _parallel_split(n, chunks, pos, digits);
+    std::vector<future_type> futures;
+    difference_type result = 0;
+
+    // Count each chunk in its own thread, the first one in the calling thread
+    for (difference_type k = 1; k < chunks; ++k) {
+        const auto chunk_first = first + offsets[k];
+        const auto chunk_last = first + offsets[k + 1];
+        futures.push_back(std::async(std::launch::async, [=](){
+            return bit::count(chunk_first, chunk_last, value);
+        }));
+    }
+    result = bit::count(first, first + offsets[1], value);
+    for (future_type& future: futures) {
+        result += future.get();
+    }
+    return result;
+}
+
+// Finds the first bit equal to the provided bit value in parallel
+template <class ExecutionPolicy, class RandomIt>
+_enable_if_execution_policy_t<ExecutionPolicy, bit_iterator<RandomIt>> find(
+    ExecutionPolicy&&,
+    bit_iterator<RandomIt> first,
+    bit_iterator<RandomIt> last,
+    bit_value value
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+
+    // Types and constants
+    using word_type = typename bit_iterator<RandomIt>::word_type;
+    using difference_type = typename bit_iterator<RandomIt>::difference_type;
+    using future_type = std::future<bit_iterator<RandomIt>>;
+    constexpr difference_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    const difference_type n = last - first;
+    const difference_type pos = first.position();
+    const difference_type words = n / digits;
+    const difference_type chunks = _parallel_chunks<ExecutionPolicy>(words);
+    const auto offsets = _parallel_split(n, chunks, pos, digits);
+    std::vector<future_type> futures;
+    bit_iterator<RandomIt> result = first;
+
+    // Search each chunk in its own thread, the first one in the calling thread
+    for (difference_type k = 1; k < chunks; ++k) {
+        const auto chunk_first = first + offsets[k];
+        const auto chunk_last = first + offsets[k + 1];
+        futures.push_back(std::async(std::launch::async, [=](){
+            return bit::find(chunk_first, chunk_last, value);
+        }));
+    }
+    result = bit::find(first, first + offsets[1], value);
+    for (difference_type k = 1; k < chunks; ++k) {
+        if (result != first + offsets[k]) {
+            break;
+        }
+        result = futures[k - 1].get();
+    }
+    return result;
+}
+
+// Copies a range of bits to another range in parallel
+template <class ExecutionPolicy, class RandomIt1, class RandomIt2>
+_enable_if_execution_policy_t<ExecutionPolicy, bit_iterator<RandomIt2>> copy(
+    ExecutionPolicy&&,
+    bit_iterator<RandomIt1> first,
+    bit_iterator<RandomIt1> last,
+    bit_iterator<RandomIt2> d_first
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+
+    // Types and constants
+    using word_type = typename bit_iterator<RandomIt2>::word_type;
+    using difference_type = typename bit_iterator<RandomIt1>::difference_type;
+    using future_type = std::future<void>;
+    constexpr difference_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    const difference_type n = last - first;
+    const difference_type pos = d_first.position();
+    const difference_type words = n / digits;
+    const difference_type chunks = _parallel_chunks<ExecutionPolicy>(words);
+    const auto offsets = _parallel_split(n, chunks, pos, digits);
+    std::vector<future_type> futures;
+
+    // Copy each chunk in its own thread, the first one in the calling thread
+    for (difference_type k = 1; k < chunks; ++k) {
+        const auto chunk_first = first + offsets[k];
+        const auto chunk_last = first + offsets[k + 1];
+        const auto chunk_d_first = d_first + offsets[k];
+        futures.push_back(std::async(std::launch::async, [=](){
+            bit::copy(chunk_first, chunk_last, chunk_d_first);
+        }));
+    }
+    bit::copy(first, first + offsets[1], d_first);
+    for (future_type& future: futures) {
+        future.get();
+    }
+    return d_first + n;
+}
+
+// Fills a range of bits with the provided bit value in parallel
+template <class ExecutionPolicy, class RandomIt>
+_enable_if_execution_policy_t<ExecutionPolicy, void> fill(
+    ExecutionPolicy&&,
+    bit_iterator<RandomIt> first,
+    bit_iterator<RandomIt> last,
+    bit_value value
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+
+    // Types and constants
+    using word_type = typename bit_iterator<RandomIt>::word_type;
+    using difference_type = typename bit_iterator<RandomIt>::difference_type;
+    using future_type = std::future<void>;
+    constexpr difference_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    const difference_type n = last - first;
+    const difference_type pos = first.position();
+    const difference_type words = n / digits;
+    const difference_type chunks = _parallel_chunks<ExecutionPolicy>(words);
+    const auto offsets = _parallel_split(n, chunks, pos, digits);
+    std::vector<future_type> futures;
+
+    // Fill each chunk in its own thread, the first one in the calling thread
+    for (difference_type k = 1; k < chunks; ++k) {
+        const auto chunk_first = first + offsets[k];
+        const auto chunk_last = first + offsets[k + 1];
+        futures.push_back(std::async(std::launch::async, [=](){
+            bit::fill(chunk_first, chunk_last, value);
+        }));
+    }
+    bit::fill(first, first + offsets[1], value);
+    for (future_type& future: futures) {
+        future.get();
+    }
+}
+
+// Reverses the order of the bits in the provided range in parallel, each
+// thread swapping a chunk of the first half with its mirror in a single pass
+template <class ExecutionPolicy, class RandomIt>
+_enable_if_execution_policy_t<ExecutionPolicy, void> reverse(
+    ExecutionPolicy&&,
+    bit_iterator<RandomIt> first,
+    bit_iterator<RandomIt> last
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+
+    // Types and constants
+    using word_type = typename bit_iterator<RandomIt>::word_type;
+    using difference_type = typename bit_iterator<RandomIt>::difference_type;
+    using future_type = std::future<void>;
+    constexpr difference_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    const difference_type n = last - first;
+    const difference_type half = n / 2;
+    const difference_type pos = first.position();
+    const difference_type words = half / digits;
+    const difference_type chunks = _parallel_chunks<ExecutionPolicy>(words);
+    const auto offsets = _parallel_split(half, chunks, pos, digits);
+    std::vector<difference_type> tails(chunks, 0);
+    std::vector<future_type> futures;
+    difference_type lpos = 0;
+
+    // Reverses small ranges in the calling thread
+    if (chunks <= 1) {
+        bit::reverse(first, last);
+        return;
+    }
+
+    // Leaves out the bits mirrored to a word shared by two chunks
+    for (difference_type k = 0; k + 1 < chunks; ++k) {
+        lpos = (last - offsets[k + 1]).position();
+        tails[k] = lpos == 0 ? 0 : digits - lpos;
+    }
+
+    // Swaps each chunk in its own thread, the first one in the calling thread
+    for (difference_type k = 1; k < chunks; ++k) {
+        const auto chunk_first = first + offsets[k];
+        const auto chunk_last = first + offsets[k + 1] - tails[k];
+        const auto chunk_mirror = last - offsets[k];
+        futures.push_back(std::async(std::launch::async, [=](){
+            _reverse_swap(chunk_first, chunk_last, chunk_mirror);
+        }));
+    }
+    _reverse_swap(first, first + offsets[1] - tails[0], last);
+    for (future_type& future: futures) {
+        future.get();
+    }
+
+    // Swaps the bits left out once all the threads are done
+    for (difference_type k = 0; k + 1 < chunks; ++k) {
+        _reverse_swap(
+            first + offsets[k + 1] - tails[k],
+            first + offsets[k + 1],
+            last - offsets[k + 1] + tails[k]
         );
     }
 }
+#endif
 // -------------------------------------------------------------------------- //
 
 
@@ -0,0 +1,439 @@
+// ============================= BIT ARITHMETIC ============================= //
+// Project:         The C++ Bit Library
+// Name:            bit_arithmetic.hpp
+// Description:     Multiword integer arithmetic on ranges of bits
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2015-2017]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_ARITHMETIC_HPP_INCLUDED
+#define _BIT_ARITHMETIC_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+// Project sources
+#include "bit_details.hpp"
+#include "bit_value.hpp"
+#include "bit_reference.hpp"
+#include "bit_pointer.hpp"
+#include "bit_iterator.hpp"
+#include "bit_algorithm.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* ************************* ARITHMETIC OPERATIONS ************************** */
+// Addition and subtraction
+template <class InputIt1, class InputIt2, class OutputIt>
+bit_value add(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2,
+    bit_iterator<OutputIt> d_first
+);
+template <class InputIt1, class InputIt2, class OutputIt>
+bit_value sub(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2,
+    bit_iterator<OutputIt> d_first
+);
+
+// Multiplication
+template <class InputIt1, class InputIt2, class OutputIt>
+bit_iterator<OutputIt> mul(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2,
+    bit_iterator<InputIt2> last2,
+    bit_iterator<OutputIt> d_first
+);
+/* ************************************************************************** */
+
+
+
+/* **************** IMPLEMENTATION DETAILS: WORD ARITHMETIC ***************** */
+// Carry chains
+template <class T>
+unsigned char _add_words(
+    const T* first1,
+    std::size_t n1,
+    const T* first2,
+    std::size_t n2,
+    T* d_first
+) noexcept;
+template <class T>
+unsigned char _sub_words(
+    const T* first1,
+    std::size_t n1,
+    const T* first2,
+    std::size_t n2,
+    T* d_first
+) noexcept;
+
+// Multiplication
+template <class T>
+void _mul_words(
+    const T* first1,
+    std::size_t n1,
+    const T* first2,
+    std::size_t n2,
+    T* d_first
+) noexcept;
+template <class T>
+void _karatsuba(
+    const T* first1,
+    const T* first2,
+    std::size_t n,
+    T* d_first,
+    T* buffer
+) noexcept;
+/* ************************************************************************** */
+
+
+
+// ------------------------ ADDITION AND SUBTRACTION ------------------------ //
+// Adds two ranges of bits as little endian integers and returns the carry
+template <class InputIt1, class InputIt2, class OutputIt>
+bit_value add(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2,
+    bit_iterator<OutputIt> d_first
+)
+{
+    // Assertions
+    _assert_range_viability(first1, last1);
+
+    // Types and constants
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<OutputIt>::word_type
+    >::type;
+    using size_type = typename bit_iterator<OutputIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    size_type n = std::distance(first1, last1);
+    size_type pos1 = first1.position();
+    size_type pos2 = first2.position();
+    size_type d_pos = d_first.position();
+    size_type len = 0;
+    auto it1 = first1.base();
+    auto it2 = first2.base();
+    auto d_it = d_first.base();
+    unsigned char carry = 0;
+    word_type value = 0;
+    word_type src0 = 0;
+    word_type src1 = 0;
+
+    // Add full words through the carry chain when the ranges are aligned
+    if (pos1 == 0 && pos2 == 0 && d_pos == 0) {
+        for (; n >= digits; n -= digits) {
+            carry = _addcarry(carry, *it1, *it2, &value);
+            *d_it = value;
+            ++it1;
+            ++it2;
+            ++d_it;
+        }
+    }
+
+    // Add the unaligned and remaining bits one word at a time
+    for (; n > 0; n -= len) {
+        len = std::min(n, digits);
+        src0 = _read_word(it1, pos1, len);
+        src1 = _read_word(it2, pos2, len);
+        if (len == digits) {
+            carry = _addcarry(carry, src0, src1, &value);
+        } else {
+            value = _bextr<word_type>(src0, 0, len) + carry;
+            value += _bextr<word_type>(src1, 0, len);
+            carry = static_cast<bool>(value >> len);
+        }
+        _write_word(d_it, d_pos, len, value);
+        pos1 += len;
+        it1 = pos1 >= digits ? std::next(it1) : it1;
+        pos1 %= digits;
+        pos2 += len;
+        it2 = pos2 >= digits ? std::next(it2) : it2;
+        pos2 %= digits;
+        d_pos += len;
+        d_it = d_pos >= digits ? std::next(d_it) : d_it;
+        d_pos %= digits;
+    }
+    return carry ? bit1 : bit0;
+}
+
+// Subtracts two ranges of bits as little endian integers and returns the borrow
+template <class InputIt1, class InputIt2, class OutputIt>
+bit_value sub(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2,
+    bit_iterator<OutputIt> d_first
+)
+{
+    // Assertions
+    _assert_range_viability(first1, last1);
+
+    // Types and constants
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<OutputIt>::word_type
+    >::type;
+    using size_type = typename bit_iterator<OutputIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    size_type n = std::distance(first1, last1);
+    size_type pos1 = first1.position();
+    size_type pos2 = first2.position();
+    size_type d_pos = d_first.position();
+    size_type len = 0;
+    auto it1 = first1.base();
+    auto it2 = first2.base();
+    auto d_it = d_first.base();
+    unsigned char borrow = 0;
+    word_type value = 0;
+    word_type src0 = 0;
+    word_type src1 = 0;
+
+    // Subtract full words through the borrow chain when the ranges are aligned
+    if (pos1 == 0 && pos2 == 0 && d_pos == 0) {
+        for (; n >= digits; n -= digits) {
+            borrow = _subborrow(borrow, *it1, *it2, &value);
+            *d_it = value;
+            ++it1;
+            ++it2;
+            ++d_it;
+        }
+    }
+
+    // Subtract the unaligned and remaining bits one word at a time
+    for (; n > 0; n -= len) {
+        len = std::min(n, digits);
+        src0 = _read_word(it1, pos1, len);
+        src1 = _read_word(it2, pos2, len);
+        if (len == digits) {
+            borrow = _subborrow(borrow, src0, src1, &value);
+        } else {
+            value = _bextr<word_type>(src0, 0, len) - borrow;
+            value -= _bextr<word_type>(src1, 0, len);
+            borrow = static_cast<bool>((value >> len) & 1);
+        }
+        _write_word(d_it, d_pos, len, value);
+        pos1 += len;
+        it1 = pos1 >= digits ? std::next(it1) : it1;
+        pos1 %= digits;
+        pos2 += len;
+        it2 = pos2 >= digits ? std::next(it2) : it2;
+        pos2 %= digits;
+        d_pos += len;
+        d_it = d_pos >= digits ? std::next(d_it) : d_it;
+        d_pos %= digits;
+    }
+    return borrow ? bit1 : bit0;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------------- MULTIPLICATION ----------------------------- //
+// Multiplies two ranges of bits into the n1 + n2 bits starting at d_first
+template <class InputIt1, class InputIt2, class OutputIt>
+bit_iterator<OutputIt> mul(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2,
+    bit_iterator<InputIt2> last2,
+    bit_iterator<OutputIt> d_first
+)
+{
+    // Assertions
+    _assert_range_viability(first1, last1);
+    _assert_range_viability(first2, last2);
+
+    // Types and constants
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<OutputIt>::word_type
+    >::type;
+    using size_type = typename bit_iterator<OutputIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr size_type block_digits = 4096;
+    constexpr size_type words = block_digits / digits;
+
+    // Initialization
+    const size_type n1 = std::distance(first1, last1);
+    const size_type n2 = std::distance(first2, last2);
+    const bit_iterator<OutputIt> d_last = std::next(d_first, n1 + n2);
+    word_type lhs[words];
+    word_type rhs[words];
+    word_type product[words + words];
+    word_type buffer[words * 4 + 128];
+    bit_iterator<word_type*> product_first(product);
+    bit_iterator<OutputIt> it = d_first;
+    size_type len1 = 0;
+    size_type len2 = 0;
+    size_type w1 = 0;
+    size_type w2 = 0;
+    bit_value carry = bit0;
+
+    // Accumulate the products of blocks of at most block_digits bits
+    bit::fill(d_first, d_last, bit0);
+    for (size_type i = 0; i < n1; i += block_digits) {
+        len1 = std::min(n1 - i, block_digits);
+        w1 = (len1 + digits - 1) / digits;
+        lhs[w1 - 1] = 0;
+        bit::copy_n(std::next(first1, i), len1, bit_iterator<word_type*>(lhs));
+        for (size_type j = 0; j < n2; j += block_digits) {
+            len2 = std::min(n2 - j, block_digits);
+            w2 = (len2 + digits - 1) / digits;
+            rhs[w2 - 1] = 0;
+            bit::copy_n(
+                std::next(first2, j), len2, bit_iterator<word_type*>(rhs)
+            );
+            if (w1 == w2) {
+                _karatsuba<word_type>(lhs, rhs, w1, product, buffer);
+            } else {
+                _mul_words<word_type>(lhs, w1, rhs, w2, product);
+            }
+            it = std::next(d_first, i + j);
+            carry = bit::add(
+                it, std::next(it, len1 + len2), product_first, it
+            );
+            if (carry) {
+                it = bit::find(std::next(it, len1 + len2), d_last, bit0);
+                bit::fill(std::next(d_first, i + j + len1 + len2), it, bit0);
+                *it = bit1;
+            }
+        }
+    }
+    return d_last;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------- IMPLEMENTATION DETAILS: WORD ARITHMETIC: CARRY CHAINS ---------- //
+// Adds n2 words to n1 >= n2 words and returns the carry, d_first may alias
+template <class T>
+unsigned char _add_words(
+    const T* first1,
+    std::size_t n1,
+    const T* first2,
+    std::size_t n2,
+    T* d_first
+) noexcept
+{
+    unsigned char carry = 0;
+    std::size_t i = 0;
+    for (; i < n2; ++i) {
+        carry = _addcarry(carry, first1[i], first2[i], d_first + i);
+    }
+    for (; i < n1; ++i) {
+        carry = _addcarry(carry, first1[i], static_cast<T>(0), d_first + i);
+    }
+    return carry;
+}
+
+// Subtracts n2 words to n1 >= n2 words and returns the borrow
+template <class T>
+unsigned char _sub_words(
+    const T* first1,
+    std::size_t n1,
+    const T* first2,
+    std::size_t n2,
+    T* d_first
+) noexcept
+{
+    unsigned char borrow = 0;
+    std::size_t i = 0;
+    for (; i < n2; ++i) {
+        borrow = _subborrow(borrow, first1[i], first2[i], d_first + i);
+    }
+    for (; i < n1; ++i) {
+        borrow = _subborrow(borrow, first1[i], static_cast<T>(0), d_first + i);
+    }
+    return borrow;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------- IMPLEMENTATION DETAILS: WORD ARITHMETIC: MULTIPLICATION --------- //
+// Multiplies n1 words by n2 words into n1 + n2 words with the schoolbook method
+template <class T>
+void _mul_words(
+    const T* first1,
+    std::size_t n1,
+    const T* first2,
+    std::size_t n2,
+    T* d_first
+) noexcept
+{
+    T lo = 0;
+    T hi = 0;
+    T carry = 0;
+    std::fill(d_first, d_first + n1 + n2, static_cast<T>(0));
+    for (std::size_t j = 0; j < n2; ++j) {
+        carry = 0;
+        for (std::size_t i = 0; i < n1; ++i) {
+            lo = _mulx(first1[i], first2[j], &hi);
+            hi += static_cast<T>(_addcarry(0, lo, carry, &lo));
+            hi += static_cast<T>(_addcarry(0, lo, d_first[i + j], &lo));
+            d_first[i + j] = lo;
+            carry = hi;
+        }
+        d_first[n1 + j] = carry;
+    }
+}
+
+// Multiplies n words by n words recursively, the buffer holding 4n+128 words
+template <class T>
+void _karatsuba(
+    const T* first1,
+    const T* first2,
+    std::size_t n,
+    T* d_first,
+    T* buffer
+) noexcept
+{
+    // Types and constants
+    constexpr std::size_t threshold = 32;
+
+    // Initialization
+    const std::size_t lo = n / 2;
+    const std::size_t hi = n - lo;
+    T* sum1 = buffer;
+    T* sum2 = sum1 + hi + 1;
+    T* mid = sum2 + hi + 1;
+
+    // Multiply small numbers with the schoolbook method
+    if (n < threshold) {
+        _mul_words(first1, n, first2, n, d_first);
+    // Compute the middle product from the sums of the low and high halves
+    } else {
+        _karatsuba(first1, first2, lo, d_first, buffer);
+        _karatsuba(first1 + lo, first2 + lo, hi, d_first + lo + lo, buffer);
+        sum1[hi] = _add_words(first1 + lo, hi, first1, lo, sum1);
+        sum2[hi] = _add_words(first2 + lo, hi, first2, lo, sum2);
+        _karatsuba<T>(sum1, sum2, hi + 1, mid, mid + hi + hi + 2);
+        _sub_words<T>(mid, hi + hi + 2, d_first, lo + lo, mid);
+        _sub_words<T>(mid, hi + hi + 2, d_first + lo + lo, hi + hi, mid);
+        _add_words<T>(
+            d_first + lo, lo + hi + hi, mid, hi + hi + 2, d_first + lo
+        );
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _BIT_ARITHMETIC_HPP_INCLUDED
+// ========================================================================== //
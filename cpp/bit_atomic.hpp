@@ -0,0 +1,401 @@
+// =============================== BIT ATOMIC =============================== //
+// Project:         The C++ Bit Library
+// Name:            bit_atomic.hpp
+// Description:     Lock-free references and algorithms on atomic words
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2015-2017]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_ATOMIC_HPP_INCLUDED
+#define _BIT_ATOMIC_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <atomic>
+// Project sources
+#include "bit_details.hpp"
+#include "bit_value.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* ************************** ATOMIC BIT REFERENCE ************************** */
+// Atomic bit reference class definition
+template <class WordType>
+class atomic_bit_reference
+{
+    // Assertions
+    static_assert(binary_digits<WordType>::value, "");
+    static_assert(!std::is_const<WordType>::value, "");
+
+    // Types
+    public:
+    using word_type = WordType;
+    using atomic_type = std::atomic<word_type>;
+    using size_type = std::size_t;
+
+    // Lifecycle
+    public:
+    atomic_bit_reference(const atomic_bit_reference& other) noexcept = default;
+    explicit atomic_bit_reference(atomic_type& ref) noexcept;
+    atomic_bit_reference(atomic_type& ref, size_type pos);
+
+    // Assignment
+    public:
+    atomic_bit_reference& operator=(const atomic_bit_reference& other) noexcept;
+    atomic_bit_reference& operator=(bit_value val) noexcept;
+
+    // Bitwise assignment operators
+    public:
+    atomic_bit_reference& operator&=(bit_value other) noexcept;
+    atomic_bit_reference& operator|=(bit_value other) noexcept;
+    atomic_bit_reference& operator^=(bit_value other) noexcept;
+
+    // Conversion
+    public:
+    explicit operator bool() const noexcept;
+
+    // Atomic operations
+    public:
+    bit_value load(
+        std::memory_order order = std::memory_order_seq_cst
+    ) const noexcept;
+    void store(
+        bit_value val,
+        std::memory_order order = std::memory_order_seq_cst
+    ) noexcept;
+    bit_value exchange(
+        bit_value val,
+        std::memory_order order = std::memory_order_seq_cst
+    ) noexcept;
+    bit_value fetch_set(
+        std::memory_order order = std::memory_order_seq_cst
+    ) noexcept;
+    bit_value fetch_reset(
+        std::memory_order order = std::memory_order_seq_cst
+    ) noexcept;
+    bit_value fetch_flip(
+        std::memory_order order = std::memory_order_seq_cst
+    ) noexcept;
+
+    // Bit manipulation
+    public:
+    atomic_bit_reference& set(bool b) noexcept;
+    atomic_bit_reference& set() noexcept;
+    atomic_bit_reference& reset() noexcept;
+    atomic_bit_reference& flip() noexcept;
+
+    // Underlying details
+    public:
+    atomic_type* address() const noexcept;
+    size_type position() const noexcept;
+    word_type mask() const noexcept;
+
+    // Implementation details: data members
+    private:
+    atomic_type* _ptr;
+    word_type _mask;
+};
+/* ************************************************************************** */
+
+
+
+/* ************************* ATOMIC BIT ALGORITHMS ************************** */
+// Search
+template <class WordType>
+std::size_t find_and_set_first_zero(
+    std::atomic<WordType>* first,
+    std::atomic<WordType>* last,
+    std::size_t hint = 0,
+    std::memory_order order = std::memory_order_acq_rel
+) noexcept;
+/* ************************************************************************** */
+
+
+
+// -------------------- ATOMIC BIT REFERENCE: LIFECYCLE --------------------- //
+// Explicitly constructs an aligned atomic bit reference
+template <class WordType>
+atomic_bit_reference<WordType>::atomic_bit_reference(
+    atomic_type& ref
+) noexcept
+: _ptr(&ref)
+, _mask(1)
+{
+}
+
+// Explicitly constructs an unaligned atomic bit reference
+template <class WordType>
+atomic_bit_reference<WordType>::atomic_bit_reference(
+    atomic_type& ref,
+    size_type pos
+)
+: _ptr((assert(pos < binary_digits<word_type>::value), &ref))
+, _mask(static_cast<word_type>(1) << pos)
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- ATOMIC BIT REFERENCE: ASSIGNMENT -------------------- //
+// Copies the value of an atomic bit reference to the atomic bit reference
+template <class WordType>
+atomic_bit_reference<WordType>& atomic_bit_reference<WordType>::operator=(
+    const atomic_bit_reference& other
+) noexcept
+{
+    store(other.load());
+    return *this;
+}
+
+// Assigns a bit value to the atomic bit reference
+template <class WordType>
+atomic_bit_reference<WordType>& atomic_bit_reference<WordType>::operator=(
+    bit_value val
+) noexcept
+{
+    store(val);
+    return *this;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------- ATOMIC BIT REFERENCE: BITWISE ASSIGNMENT OPERATORS ----------- //
+// Atomically assigns the referenced bit through a bitwise and operation
+template <class WordType>
+atomic_bit_reference<WordType>& atomic_bit_reference<WordType>::operator&=(
+    bit_value other
+) noexcept
+{
+    other ? void() : void(fetch_reset());
+    return *this;
+}
+
+// Atomically assigns the referenced bit through a bitwise or operation
+template <class WordType>
+atomic_bit_reference<WordType>& atomic_bit_reference<WordType>::operator|=(
+    bit_value other
+) noexcept
+{
+    other ? void(fetch_set()) : void();
+    return *this;
+}
+
+// Atomically assigns the referenced bit through a bitwise xor operation
+template <class WordType>
+atomic_bit_reference<WordType>& atomic_bit_reference<WordType>::operator^=(
+    bit_value other
+) noexcept
+{
+    other ? void(fetch_flip()) : void();
+    return *this;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- ATOMIC BIT REFERENCE: CONVERSION -------------------- //
+// Explicitly converts the atomic bit reference to a boolean value
+template <class WordType>
+atomic_bit_reference<WordType>::operator bool(
+) const noexcept
+{
+    return static_cast<bool>(load());
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------- ATOMIC BIT REFERENCE: ATOMIC OPERATIONS ----------------- //
+// Atomically loads the value of the referenced bit
+template <class WordType>
+bit_value atomic_bit_reference<WordType>::load(
+    std::memory_order order
+) const noexcept
+{
+    return _ptr->load(order) & _mask ? bit1 : bit0;
+}
+
+// Atomically stores a value in the referenced bit
+template <class WordType>
+void atomic_bit_reference<WordType>::store(
+    bit_value val,
+    std::memory_order order
+) noexcept
+{
+    val ? void(fetch_set(order)) : void(fetch_reset(order));
+}
+
+// Atomically stores a value in the referenced bit and returns the old one
+template <class WordType>
+bit_value atomic_bit_reference<WordType>::exchange(
+    bit_value val,
+    std::memory_order order
+) noexcept
+{
+    return val ? fetch_set(order) : fetch_reset(order);
+}
+
+// Atomically sets the referenced bit to 1 and returns its old value
+template <class WordType>
+bit_value atomic_bit_reference<WordType>::fetch_set(
+    std::memory_order order
+) noexcept
+{
+    return _ptr->fetch_or(_mask, order) & _mask ? bit1 : bit0;
+}
+
+// Atomically resets the referenced bit to 0 and returns its old value
+template <class WordType>
+bit_value atomic_bit_reference<WordType>::fetch_reset(
+    std::memory_order order
+) noexcept
+{
+    const word_type msk = ~_mask;
+    return _ptr->fetch_and(msk, order) & _mask ? bit1 : bit0;
+}
+
+// Atomically flips the referenced bit and returns its old value
+template <class WordType>
+bit_value atomic_bit_reference<WordType>::fetch_flip(
+    std::memory_order order
+) noexcept
+{
+    return _ptr->fetch_xor(_mask, order) & _mask ? bit1 : bit0;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------- ATOMIC BIT REFERENCE: BIT MANIPULATION ----------------- //
+// Atomically sets the value of the referenced bit to the provided value
+template <class WordType>
+atomic_bit_reference<WordType>& atomic_bit_reference<WordType>::set(
+    bool b
+) noexcept
+{
+    b ? set() : reset();
+    return *this;
+}
+
+// Atomically sets the value of the referenced bit to 1
+template <class WordType>
+atomic_bit_reference<WordType>& atomic_bit_reference<WordType>::set(
+) noexcept
+{
+    fetch_set();
+    return *this;
+}
+
+// Atomically resets the value of the referenced bit to 0
+template <class WordType>
+atomic_bit_reference<WordType>& atomic_bit_reference<WordType>::reset(
+) noexcept
+{
+    fetch_reset();
+    return *this;
+}
+
+// Atomically flips the value of the referenced bit
+template <class WordType>
+atomic_bit_reference<WordType>& atomic_bit_reference<WordType>::flip(
+) noexcept
+{
+    fetch_flip();
+    return *this;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------- ATOMIC BIT REFERENCE: UNDERLYING DETAILS ---------------- //
+// Returns a pointer to the underlying atomic word
+template <class WordType>
+typename atomic_bit_reference<WordType>::atomic_type*
+atomic_bit_reference<WordType>::address(
+) const noexcept
+{
+    return _ptr;
+}
+
+// Returns the position of the referenced bit within the underlying word
+template <class WordType>
+typename atomic_bit_reference<WordType>::size_type
+atomic_bit_reference<WordType>::position(
+) const noexcept
+{
+    return _tzcnt(_mask);
+}
+
+// Returns a mask corresponding to the referenced bit
+template <class WordType>
+typename atomic_bit_reference<WordType>::word_type
+atomic_bit_reference<WordType>::mask(
+) const noexcept
+{
+    return _mask;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- ATOMIC BIT ALGORITHMS: SEARCH ---------------------- //
+// Atomically claims the first zero bit at or after the word of the hint,
+// wrapping around, and returns its position or the size if there is none
+template <class WordType>
+std::size_t find_and_set_first_zero(
+    std::atomic<WordType>* first,
+    std::atomic<WordType>* last,
+    std::size_t hint,
+    std::memory_order order
+) noexcept
+{
+    // Types and constants
+    using word_type = WordType;
+    using size_type = std::size_t;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr word_type ones = std::numeric_limits<word_type>::max();
+    constexpr word_type one = 1;
+
+    // Initialization
+    const size_type words = std::distance(first, last);
+    const size_type start = words ? hint / digits % words : 0;
+    size_type index = start;
+    size_type pos = 0;
+    word_type word = 0;
+
+    // Scan each word once, find a zero with tzcnt and claim it with a cas
+    for (size_type i = 0; i < words; ++i) {
+        std::atomic<word_type>& ref = first[index];
+        word = ref.load(std::memory_order_relaxed);
+        while (word != ones) {
+            pos = _tzcnt(static_cast<word_type>(~word));
+            if (ref.compare_exchange_weak(
+                word,
+                static_cast<word_type>(word | (one << pos)),
+                order,
+                std::memory_order_relaxed
+            )) {
+                return index * digits + pos;
+            }
+        }
+        index = index + 1 < words ? index + 1 : 0;
+    }
+    return words * digits;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _BIT_ATOMIC_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,939 @@
+// ============================= BIT BENCHMARK ============================== //
+// Project:         The C++ Bit Library
+// Name:            bit_benchmark.cpp
+// Description:     Benchmarks the bit algorithms and the bit instructions
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2015-2017]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+// Compilation:
+// g++ -std=c++14 -Wall -Wextra -pedantic -O3 -march=native bit_benchmark.cpp
+//     -o bit_benchmark -lbenchmark -lpthread
+// Execution
+// ./bit_benchmark --benchmark_filter=count --benchmark_repetitions=5
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cmath>
+#include <deque>
+#include <atomic>
+#include <limits>
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <numeric>
+#include <functional>
+// Project sources
+#include "bit.hpp"
+// Third-party libraries
+#include <benchmark/benchmark.h>
+// Miscellaneous
+using namespace bit;
+// ========================================================================== //
+
+
+
+// ================================ HELPERS ================================= //
+// Number of words processed by the instruction benchmarks
+constexpr std::size_t instruction_words = 4096;
+
+// Size of the ranges in bytes: from a single word up to hundreds of megabytes
+void range_sizes(benchmark::internal::Benchmark* b)
+{
+    constexpr std::int64_t min_bytes = 8;
+    constexpr std::int64_t max_bytes = std::int64_t(256) << 20;
+    b->ArgNames({"bytes", "unaligned"});
+    for (std::int64_t bytes = min_bytes; bytes <= max_bytes; bytes <<= 3) {
+        b->Args({bytes, 0});
+        b->Args({bytes, 1});
+    }
+    b->Args({max_bytes, 0});
+    b->Args({max_bytes, 1});
+}
+
+// Makes a random vector of words
+template <class T>
+std::vector<T> make_random_vector(std::size_t size)
+{
+    std::vector<T> v(size);
+    std::mt19937_64 engine(size);
+    std::uniform_int_distribution<std::uintmax_t> distribution(
+        std::numeric_limits<T>::min(),
+        std::numeric_limits<T>::max()
+    );
+    for (std::size_t i = 0; i < size; ++i) {
+        v[i] = distribution(engine);
+    }
+    return v;
+}
+
+// Number of words of the ranges of a benchmark
+template <class T>
+std::size_t words(const benchmark::State& state)
+{
+    return std::max<std::size_t>(state.range(0) / sizeof(T), 1);
+}
+
+// Makes a random vector of 256-bit blocks of words for a benchmark
+template <class T>
+std::vector<word_block<T, 32 / sizeof(T)>> make_random_blocks(
+    const benchmark::State& state
+)
+{
+    using block_type = word_block<T, 32 / sizeof(T)>;
+    std::vector<block_type> v(words<block_type>(state));
+    auto w = make_random_vector<T>(v.size() * block_type::size());
+    for (std::size_t i = 0; i < w.size(); ++i) {
+        v[i / block_type::size()][i % block_type::size()] = w[i];
+    }
+    return v;
+}
+
+// Beginning of a range over a vector, unaligned if the benchmark requires it
+template <class T>
+bit_iterator<T*> make_first(std::vector<T>& v, const benchmark::State& state)
+{
+    return bit_iterator<T*>(v.data()) + 3 * (state.range(1) != 0);
+}
+
+// End of a range over a vector, unaligned if the benchmark requires it
+template <class T>
+bit_iterator<T*> make_last(std::vector<T>& v, const benchmark::State& state)
+{
+    return bit_iterator<T*>(v.data() + v.size()) - 3 * (state.range(1) != 0);
+}
+
+// Beginning of a destination range, unaligned with the source if required
+template <class T>
+bit_iterator<T*> make_d_first(std::vector<T>& v, const benchmark::State& state)
+{
+    return bit_iterator<T*>(v.data()) + 1 * (state.range(1) != 0);
+}
+
+// Reports the throughput in bits per second
+void report(benchmark::State& state, std::size_t bits)
+{
+    using byte_t = unsigned char;
+    constexpr std::size_t byte = std::numeric_limits<byte_t>::digits;
+    state.SetBytesProcessed(state.iterations() * (bits / byte));
+    state.counters["bits/s"] = benchmark::Counter(
+        static_cast<double>(bits),
+        benchmark::Counter::kIsIterationInvariantRate
+    );
+}
+// ========================================================================== //
+
+
+
+// =============================== ALGORITHMS =============================== //
+// Counts the bits set to one
+template <class T>
+void bm_count(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::count(first, last, bit1));
+    }
+    report(state, last - first);
+}
+
+// Counts the bits set to one in the intersection of two ranges
+template <class T>
+void bm_transform_count(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    auto w = make_random_vector<T>(words<T>(state) + 1);
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    const auto first2 = make_d_first(w, state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::transform_count(
+            first, last, first2, std::bit_and<T>()
+        ));
+    }
+    report(state, last - first);
+}
+
+// Counts the bits set in the first range and not in the second in one pass
+template <class T>
+void bm_transform_reduce(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    auto w = make_random_vector<T>(words<T>(state) + 1);
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    const auto first2 = make_d_first(w, state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::transform_reduce(
+            first, last, first2, std::size_t(), std::plus<std::size_t>(),
+            [](T x, T y) {return static_cast<T>(x & ~y);}
+        ));
+    }
+    report(state, last - first);
+}
+
+// Finds a bit absent from the range
+template <class T>
+void bm_find(benchmark::State& state)
+{
+    std::vector<T> v(words<T>(state));
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::find(first, last, bit1));
+    }
+    report(state, last - first);
+}
+
+// Finds the last occurrence of a bit absent from the range
+template <class T>
+void bm_find_last(benchmark::State& state)
+{
+    std::vector<T> v(words<T>(state));
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::find_last(first, last, bit1));
+    }
+    report(state, last - first);
+}
+
+// Copies a range to another buffer
+template <class T>
+void bm_copy(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    std::vector<T> w(v.size() + 1);
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    const auto d_first = make_d_first(w, state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::copy(first, last, d_first));
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Copies a number of bits to another buffer
+template <class T>
+void bm_copy_n(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    std::vector<T> w(v.size() + 1);
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    const auto d_first = make_d_first(w, state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::copy_n(first, last - first, d_first));
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Copies a range to another buffer starting from the end
+template <class T>
+void bm_copy_backward(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    std::vector<T> w(v.size() + 1);
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    const auto d_last = make_d_first(w, state) + (last - first);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::copy_backward(first, last, d_last));
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Negates a range into another buffer
+template <class T>
+void bm_transform_unary(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    std::vector<T> w(v.size() + 1);
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    const auto d_first = make_d_first(w, state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::transform(
+            first, last, d_first, std::bit_not<T>()
+        ));
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Intersects two ranges into another buffer
+template <class T>
+void bm_transform_binary(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    auto w = make_random_vector<T>(words<T>(state));
+    std::vector<T> x(v.size() + 1);
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    const auto first2 = make_first(w, state);
+    const auto d_first = make_d_first(x, state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::transform(
+            first, last, first2, d_first, std::bit_and<T>()
+        ));
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Sets all the bits of a range
+template <class T>
+void bm_fill(benchmark::State& state)
+{
+    std::vector<T> v(words<T>(state));
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    for (auto _: state) {
+        bit::fill(first, last, bit1);
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Sets a number of bits of a range
+template <class T>
+void bm_fill_n(benchmark::State& state)
+{
+    std::vector<T> v(words<T>(state));
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::fill_n(first, last - first, bit1));
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Assigns alternating bits to a range
+template <class T>
+void bm_generate(benchmark::State& state)
+{
+    std::vector<T> v(words<T>(state));
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    bool value = false;
+    for (auto _: state) {
+        bit::generate(first, last, [&value](){return value = !value;});
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Reverses a range
+template <class T>
+void bm_reverse(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    for (auto _: state) {
+        bit::reverse(first, last);
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Rotates a range by a few bits
+template <class T>
+void bm_rotate(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    for (auto _: state) {
+        bit::rotate(first, std::next(first, (last - first) / 8), last);
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Shifts a range by a few bits towards its beginning
+template <class T>
+void bm_shift_left(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    for (auto _: state) {
+        bit::shift_left(first, last, 3);
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Shifts a range by a few bits towards its end
+template <class T>
+void bm_shift_right(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    for (auto _: state) {
+        bit::shift_right(first, last, 3);
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Compacts the bits of a range selected by a random mask
+template <class T>
+void bm_pack(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    auto m = make_random_vector<T>(words<T>(state));
+    std::vector<T> w(v.size() + 1);
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    const auto mask_first = make_first(m, state);
+    const auto d_first = make_d_first(w, state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::pack(first, last, mask_first, d_first));
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Expands packed bits to the positions selected by a random mask
+template <class T>
+void bm_unpack(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    auto m = make_random_vector<T>(words<T>(state));
+    std::vector<T> w(v.size() + 1);
+    const auto first = make_first(v, state);
+    const auto mask_first = make_first(m, state);
+    const auto mask_last = make_last(m, state);
+    const auto d_first = make_d_first(w, state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(
+            bit::unpack(mask_first, mask_last, first, d_first)
+        );
+        benchmark::ClobberMemory();
+    }
+    report(state, mask_last - mask_first);
+}
+
+// Transposes the largest square matrix that fits in a range
+template <class T>
+void bm_transpose(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    std::vector<T> w(v.size() + 1);
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    const auto d_first = make_d_first(w, state);
+    const std::size_t n = std::sqrt(static_cast<double>(last - first));
+    const std::ptrdiff_t stride = n;
+    for (auto _: state) {
+        bit::transpose(first, n, n, stride, d_first, stride);
+        benchmark::ClobberMemory();
+    }
+    report(state, n * n);
+}
+
+// Counts the bits set to one in a deque
+template <class T>
+void bm_count_deque(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    std::deque<T> d(v.begin(), v.end());
+    const std::size_t offset = 3 * (state.range(1) != 0);
+    const auto first = bit_iterator<decltype(d.begin())>(d.begin()) + offset;
+    const auto last = bit_iterator<decltype(d.end())>(d.end()) - offset;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::count(first, last, bit1));
+    }
+    report(state, last - first);
+}
+
+// Reverses a range in a deque
+template <class T>
+void bm_reverse_deque(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    std::deque<T> d(v.begin(), v.end());
+    const std::size_t offset = 3 * (state.range(1) != 0);
+    const auto first = bit_iterator<decltype(d.begin())>(d.begin()) + offset;
+    const auto last = bit_iterator<decltype(d.end())>(d.end()) - offset;
+    for (auto _: state) {
+        bit::reverse(first, last);
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Hashes a range
+template <class T>
+void bm_hash(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::hash(first, last));
+    }
+    report(state, last - first);
+}
+
+// Counts the bits set to one in 256-bit blocks of words
+template <class T>
+void bm_count_block(benchmark::State& state)
+{
+    auto v = make_random_blocks<T>(state);
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::count(first, last, bit1));
+    }
+    report(state, last - first);
+}
+
+// Reverses a range of 256-bit blocks of words
+template <class T>
+void bm_reverse_block(benchmark::State& state)
+{
+    auto v = make_random_blocks<T>(state);
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    for (auto _: state) {
+        bit::reverse(first, last);
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Registration for all word types and range sizes
+#define BIT_BENCHMARK_ALGORITHM(name)                                          \
+    BENCHMARK_TEMPLATE(name, std::uint8_t)->Apply(range_sizes);                \
+    BENCHMARK_TEMPLATE(name, std::uint16_t)->Apply(range_sizes);               \
+    BENCHMARK_TEMPLATE(name, std::uint32_t)->Apply(range_sizes);               \
+    BENCHMARK_TEMPLATE(name, std::uint64_t)->Apply(range_sizes)
+BIT_BENCHMARK_ALGORITHM(bm_count);
+BIT_BENCHMARK_ALGORITHM(bm_count_deque);
+BIT_BENCHMARK_ALGORITHM(bm_count_block);
+BIT_BENCHMARK_ALGORITHM(bm_transform_count);
+BIT_BENCHMARK_ALGORITHM(bm_transform_reduce);
+BIT_BENCHMARK_ALGORITHM(bm_find);
+BIT_BENCHMARK_ALGORITHM(bm_find_last);
+BIT_BENCHMARK_ALGORITHM(bm_copy);
+BIT_BENCHMARK_ALGORITHM(bm_copy_n);
+BIT_BENCHMARK_ALGORITHM(bm_copy_backward);
+BIT_BENCHMARK_ALGORITHM(bm_transform_unary);
+BIT_BENCHMARK_ALGORITHM(bm_transform_binary);
+BIT_BENCHMARK_ALGORITHM(bm_fill);
+BIT_BENCHMARK_ALGORITHM(bm_fill_n);
+BIT_BENCHMARK_ALGORITHM(bm_generate);
+BIT_BENCHMARK_ALGORITHM(bm_reverse);
+BIT_BENCHMARK_ALGORITHM(bm_reverse_deque);
+BIT_BENCHMARK_ALGORITHM(bm_reverse_block);
+BIT_BENCHMARK_ALGORITHM(bm_rotate);
+BIT_BENCHMARK_ALGORITHM(bm_shift_left);
+BIT_BENCHMARK_ALGORITHM(bm_shift_right);
+BIT_BENCHMARK_ALGORITHM(bm_pack);
+BIT_BENCHMARK_ALGORITHM(bm_unpack);
+BIT_BENCHMARK_ALGORITHM(bm_transpose);
+BIT_BENCHMARK_ALGORITHM(bm_hash);
+// ========================================================================== //
+
+
+
+// =============================== REDUCTIONS =============================== //
+// Size of the masks in bytes, and density of their bits set to one
+void reduction_sizes(benchmark::internal::Benchmark* b)
+{
+    constexpr std::int64_t min_bytes = 8;
+    constexpr std::int64_t max_bytes = std::int64_t(128) << 10;
+    b->ArgNames({"bytes", "sparse"});
+    for (std::int64_t bytes = min_bytes; bytes <= max_bytes; bytes <<= 2) {
+        b->Args({bytes, 0});
+        b->Args({bytes, 1});
+    }
+}
+
+// Adds the integers selected by a random mask, a sixteenth of them if sparse
+template <class T>
+void bm_masked_sum(benchmark::State& state)
+{
+    constexpr std::size_t sparsity = 4;
+    auto m = make_random_vector<T>(words<T>(state));
+    for (std::size_t i = 1; i < sparsity * (state.range(1) != 0); ++i) {
+        auto w = make_random_vector<T>(m.size() + i);
+        for (std::size_t j = 0; j < m.size(); ++j) {
+            m[j] &= w[j];
+        }
+    }
+    const auto mask_first = bit_iterator<T*>(m.data());
+    const auto mask_last = bit_iterator<T*>(m.data() + m.size());
+    std::vector<std::int32_t> v(mask_last - mask_first);
+    std::iota(v.begin(), v.end(), 0);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::masked_sum(
+            v.begin(), v.end(), mask_first, std::int64_t()
+        ));
+    }
+    report(state, v.size());
+}
+
+// Registration for all word types and mask sizes
+BENCHMARK_TEMPLATE(bm_masked_sum, std::uint8_t)->Apply(reduction_sizes);
+BENCHMARK_TEMPLATE(bm_masked_sum, std::uint16_t)->Apply(reduction_sizes);
+BENCHMARK_TEMPLATE(bm_masked_sum, std::uint32_t)->Apply(reduction_sizes);
+BENCHMARK_TEMPLATE(bm_masked_sum, std::uint64_t)->Apply(reduction_sizes);
+// ========================================================================== //
+
+
+
+// =============================== ARITHMETIC =============================== //
+// Size of the multiplied ranges in bytes: from 256 to 4096 bits
+void multiplication_sizes(benchmark::internal::Benchmark* b)
+{
+    constexpr std::int64_t min_bytes = 32;
+    constexpr std::int64_t max_bytes = 512;
+    b->ArgNames({"bytes", "unaligned"});
+    for (std::int64_t bytes = min_bytes; bytes <= max_bytes; bytes <<= 1) {
+        b->Args({bytes, 0});
+        b->Args({bytes, 1});
+    }
+}
+
+// Adds two ranges as integers
+template <class T>
+void bm_add(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    auto w = make_random_vector<T>(words<T>(state));
+    std::vector<T> x(v.size() + 1);
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    const auto first2 = make_first(w, state);
+    const auto d_first = make_d_first(x, state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::add(first, last, first2, d_first));
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Subtracts two ranges as integers
+template <class T>
+void bm_sub(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    auto w = make_random_vector<T>(words<T>(state));
+    std::vector<T> x(v.size() + 1);
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    const auto first2 = make_first(w, state);
+    const auto d_first = make_d_first(x, state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::sub(first, last, first2, d_first));
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Multiplies two ranges as integers
+template <class T>
+void bm_mul(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    auto w = make_random_vector<T>(words<T>(state) + 1);
+    std::vector<T> x(v.size() + w.size() + 1);
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    const auto first2 = make_first(w, state);
+    const auto d_first = make_d_first(x, state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(bit::mul(
+            first, last, first2, std::next(first2, last - first), d_first
+        ));
+        benchmark::ClobberMemory();
+    }
+    report(state, last - first);
+}
+
+// Registration for all word types and range sizes
+BIT_BENCHMARK_ALGORITHM(bm_add);
+BIT_BENCHMARK_ALGORITHM(bm_sub);
+BENCHMARK_TEMPLATE(bm_mul, std::uint8_t)->Apply(multiplication_sizes);
+BENCHMARK_TEMPLATE(bm_mul, std::uint16_t)->Apply(multiplication_sizes);
+BENCHMARK_TEMPLATE(bm_mul, std::uint32_t)->Apply(multiplication_sizes);
+BENCHMARK_TEMPLATE(bm_mul, std::uint64_t)->Apply(multiplication_sizes);
+// ========================================================================== //
+
+
+
+// ================================ STREAMS ================================= //
+// Width of the fields read and written by the stream benchmarks
+constexpr std::size_t field_digits = 13;
+
+// Reads a range as a sequence of fields
+template <class T>
+void bm_bit_reader(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    const std::size_t fields = (last - first) / field_digits;
+    for (auto _: state) {
+        bit_reader<T*> reader(first, last);
+        for (std::size_t i = 0; i < fields; ++i) {
+            benchmark::DoNotOptimize(reader.read(field_digits));
+        }
+    }
+    report(state, fields * field_digits);
+}
+
+// Reads a range as a sequence of unary codes
+template <class T>
+void bm_read_unary(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    const std::size_t ones = bit::count(first, last, bit1);
+    for (auto _: state) {
+        bit_reader<T*> reader(first, last);
+        for (std::size_t i = 0; i < ones; ++i) {
+            benchmark::DoNotOptimize(reader.read_unary());
+        }
+    }
+    report(state, last - first);
+}
+
+// Writes a range as a sequence of fields
+template <class T>
+void bm_bit_writer(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    const std::size_t fields = (last - first) / field_digits;
+    for (auto _: state) {
+        bit_writer<T*> writer(first, last);
+        for (std::size_t i = 0; i < fields; ++i) {
+            writer.write(i, field_digits);
+        }
+        writer.flush();
+        benchmark::ClobberMemory();
+    }
+    report(state, fields * field_digits);
+}
+
+// Registration for all word types and range sizes
+BIT_BENCHMARK_ALGORITHM(bm_bit_reader);
+BIT_BENCHMARK_ALGORITHM(bm_read_unary);
+BIT_BENCHMARK_ALGORITHM(bm_bit_writer);
+// ========================================================================== //
+
+
+// ============================== RANK SELECT =============================== //
+// Counts the ones before random positions with a rank select index
+template <class T>
+void bm_rank(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    const rank_select_index<T*> index(first, last);
+    const auto positions = make_random_vector<std::size_t>(instruction_words);
+    std::size_t i = 0;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(index.rank(positions[i] % index.size()));
+        i = (i + 1) % positions.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Finds the positions of random ones with a rank select index
+template <class T>
+void bm_select(benchmark::State& state)
+{
+    auto v = make_random_vector<T>(words<T>(state));
+    const auto first = make_first(v, state);
+    const auto last = make_last(v, state);
+    const rank_select_index<T*> index(first, last);
+    const auto ranks = make_random_vector<std::size_t>(instruction_words);
+    std::size_t i = 0;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(index.select(ranks[i] % index.count()));
+        i = (i + 1) % ranks.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Registration for all word types and range sizes
+BIT_BENCHMARK_ALGORITHM(bm_rank);
+BIT_BENCHMARK_ALGORITHM(bm_select);
+// ========================================================================== //
+
+
+
+// ================================= ATOMIC ================================= //
+// Claims and releases slots of a shared bitmap from concurrent threads
+template <class T>
+void bm_find_and_set_first_zero(benchmark::State& state)
+{
+    constexpr std::size_t digits = binary_digits<T>::value;
+    static std::atomic<T> slots[instruction_words];
+    const std::size_t size = instruction_words * digits;
+    const std::size_t hint = size / state.threads() * state.thread_index();
+    std::size_t pos = 0;
+    for (auto _: state) {
+        pos = find_and_set_first_zero(slots, slots + instruction_words, hint);
+        atomic_bit_reference<T>(slots[pos / digits], pos % digits).reset();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Registration for all word types and a growing number of threads
+#define BIT_BENCHMARK_ATOMIC(name)                                             \
+    BENCHMARK_TEMPLATE(name, std::uint8_t)->ThreadRange(1, 64);                \
+    BENCHMARK_TEMPLATE(name, std::uint16_t)->ThreadRange(1, 64);               \
+    BENCHMARK_TEMPLATE(name, std::uint32_t)->ThreadRange(1, 64);               \
+    BENCHMARK_TEMPLATE(name, std::uint64_t)->ThreadRange(1, 64)
+BIT_BENCHMARK_ATOMIC(bm_find_and_set_first_zero);
+// ========================================================================== //
+
+
+
+// ============================== INSTRUCTIONS ============================== //
+// Instruction wrappers taking two words and returning a word
+struct popcnt_op {
+    template <class T> T operator()(T x, T) const {
+        return _popcnt(x);
+    }
+};
+struct lzcnt_op {
+    template <class T> T operator()(T x, T) const {
+        return _lzcnt(x);
+    }
+};
+struct tzcnt_op {
+    template <class T> T operator()(T x, T) const {
+        return _tzcnt(x);
+    }
+};
+struct bextr_op {
+    template <class T> T operator()(T x, T y) const {
+        return _bextr<T>(x, y % binary_digits<T>::value, y % 7);
+    }
+};
+struct pdep_op {
+    template <class T> T operator()(T x, T y) const {
+        return _pdep(x, y);
+    }
+};
+struct pext_op {
+    template <class T> T operator()(T x, T y) const {
+        return _pext(x, y);
+    }
+};
+struct byteswap_op {
+    template <class T> T operator()(T x, T) const {
+        return _byteswap(x);
+    }
+};
+struct bitswap_op {
+    template <class T> T operator()(T x, T) const {
+        return _bitswap(x);
+    }
+};
+struct bitblend_op {
+    template <class T> T operator()(T x, T y) const {
+        return _bitblend<T>(x, y, y % binary_digits<T>::value, y % 7);
+    }
+};
+struct bitcmp_op {
+    template <class T> T operator()(T x, T y) const {
+        return _bitcmp<T>(x, y, 1, y % 3, y % 5);
+    }
+};
+struct shld_op {
+    template <class T> T operator()(T x, T y) const {
+        return _shld<T>(x, y, y % binary_digits<T>::value);
+    }
+};
+struct shrd_op {
+    template <class T> T operator()(T x, T y) const {
+        return _shrd<T>(x, y, y % binary_digits<T>::value);
+    }
+};
+struct addcarry_op {
+    template <class T> T operator()(T x, T y) const {
+        T dst = 0;
+        return _addcarry<unsigned char>(x & 1, x, y, &dst) + dst;
+    }
+};
+struct subborrow_op {
+    template <class T> T operator()(T x, T y) const {
+        T dst = 0;
+        return _subborrow<unsigned char>(x & 1, x, y, &dst) + dst;
+    }
+};
+struct mulx_op {
+    template <class T> T operator()(T x, T y) const {
+        T hi = 0;
+        return _mulx(x, y, &hi) ^ hi;
+    }
+};
+
+// Applies an instruction to consecutive words of a random vector
+template <class T, class Op>
+void bm_instruction(benchmark::State& state)
+{
+    constexpr std::size_t digits = binary_digits<T>::value;
+    const auto v = make_random_vector<T>(instruction_words);
+    const Op op{};
+    for (auto _: state) {
+        T acc = 0;
+        for (std::size_t i = 1; i < v.size(); ++i) {
+            acc ^= op(v[i - 1], v[i]);
+        }
+        benchmark::DoNotOptimize(acc);
+    }
+    report(state, (v.size() - 1) * digits);
+}
+
+// Registration for all word types
+#define BIT_BENCHMARK_INSTRUCTION(op)                                          \
+    BENCHMARK_TEMPLATE(bm_instruction, std::uint8_t, op);                      \
+    BENCHMARK_TEMPLATE(bm_instruction, std::uint16_t, op);                     \
+    BENCHMARK_TEMPLATE(bm_instruction, std::uint32_t, op);                     \
+    BENCHMARK_TEMPLATE(bm_instruction, std::uint64_t, op)
+BIT_BENCHMARK_INSTRUCTION(popcnt_op);
+BIT_BENCHMARK_INSTRUCTION(lzcnt_op);
+BIT_BENCHMARK_INSTRUCTION(tzcnt_op);
+BIT_BENCHMARK_INSTRUCTION(bextr_op);
+BIT_BENCHMARK_INSTRUCTION(pdep_op);
+BIT_BENCHMARK_INSTRUCTION(pext_op);
+BIT_BENCHMARK_INSTRUCTION(byteswap_op);
+BIT_BENCHMARK_INSTRUCTION(bitswap_op);
+BIT_BENCHMARK_INSTRUCTION(bitblend_op);
+BIT_BENCHMARK_INSTRUCTION(bitcmp_op);
+BIT_BENCHMARK_INSTRUCTION(shld_op);
+BIT_BENCHMARK_INSTRUCTION(shrd_op);
+BIT_BENCHMARK_INSTRUCTION(addcarry_op);
+BIT_BENCHMARK_INSTRUCTION(subborrow_op);
+BIT_BENCHMARK_INSTRUCTION(mulx_op);
+// ========================================================================== //
+
+
+
+// ================================== MAIN ================================== //
+// Main function
+BENCHMARK_MAIN();
+// ========================================================================== //
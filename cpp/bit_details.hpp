@@ -15,8 +15,11 @@
 // ================================ PREAMBLE ================================ //
 // C++ standard library
 #include <tuple>
+#include <atomic>
 #include <limits>
 #include <cassert>
+#include <deque>
+#include <vector>
 #include <cstdint>
 #include <utility>
 #include <iterator>
@@ -26,6 +29,35 @@
 // Project sources
 // Third-party libraries
 // Miscellaneous
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+// Define BIT_RUNTIME_DISPATCH to select the vector kernels on the host cpu
+#if defined(BIT_RUNTIME_DISPATCH) && defined(__GNUC__)
+#if defined(__x86_64__) || defined(__i386__)
+#define _BIT_RUNTIME_DISPATCH
+#define _BIT_TARGET(isa) __attribute__((target(isa)))
+#endif
+#endif
+#ifndef _BIT_TARGET
+#define _BIT_TARGET(isa)
+#endif
+// Detect constant evaluation to bypass the intrinsics in constant expressions
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define _BIT_CONSTANT_EVALUATION
+#endif
+#endif
+// Define BIT_INSTRUMENTATION to count the paths taken by the algorithms
+#if defined(BIT_INSTRUMENTATION)
+#define _BIT_INSTRUMENTATION
+#define _BIT_RECORD(counters, ...)                                             \
+    (_is_constant_evaluated()                                                  \
+    ? void()                                                                   \
+    : _record(_instrumentation().counters, __VA_ARGS__))
+#else
+#define _BIT_RECORD(counters, ...) void()
+#endif
 namespace bit {
 class bit_value;
 template <class WordType> class bit_reference;
@@ -59,6 +91,71 @@ constexpr std::size_t binary_digits_v = binary_digits<T>::value;
 
 
 
+/* ******************************* ENDIANNESS ******************************* */
+// Byte order of the words stored in memory or in files
+enum class endian {
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__)
+    little = __ORDER_LITTLE_ENDIAN__,
+    big = __ORDER_BIG_ENDIAN__,
+    native = __BYTE_ORDER__
+#else
+    little = 0,
+    big = 1,
+    native = little
+#endif
+};
+/* ************************************************************************** */
+
+
+
+/* **************************** INSTRUMENTATION ***************************** */
+// Counters of the calls, paths, bits and words of an algorithm
+struct algorithm_stats {
+    std::uint64_t calls;
+    std::uint64_t aligned;
+    std::uint64_t unaligned;
+    std::uint64_t single_word;
+    std::uint64_t bits;
+    std::uint64_t words;
+};
+
+// Counters of the calls of an instruction through hardware or software
+struct instruction_stats {
+    std::uint64_t hardware;
+    std::uint64_t software;
+};
+
+// Instruction set extensions the library was compiled for
+struct instruction_set {
+    bool popcnt;
+    bool bmi2;
+    bool avx2;
+    bool avx512;
+    bool runtime_dispatch;
+};
+
+// Snapshot of the instrumentation counters
+struct instrumentation_stats {
+    bool enabled;
+    instruction_set compiled;
+    algorithm_stats count;
+    algorithm_stats find;
+    algorithm_stats copy;
+    algorithm_stats fill;
+    algorithm_stats reverse;
+    instruction_stats popcnt;
+    instruction_stats bitswap;
+    instruction_stats pext;
+    instruction_stats pdep;
+};
+
+// Queries
+inline instrumentation_stats instrumentation() noexcept;
+inline void reset_instrumentation() noexcept;
+/* ************************************************************************** */
+
+
+
 /* *************** IMPLEMENTATION DETAILS: CV ITERATOR TRAITS *************** */
 // Cv iterator traits structure definition
 template <class Iterator>
@@ -93,6 +190,73 @@ struct _cv_iterator_traits
 
 
 
+/* *********************** SEGMENTED ITERATOR TRAITS ************************ */
+// Segmented iterator traits structure definition: flat iterators by default,
+// to be specialized for chunked containers whose segments are contiguous
+template <class Iterator>
+struct segmented_iterator_traits
+{
+    // Types
+    using is_segmented_iterator = std::false_type;
+};
+
+#if defined(__GLIBCXX__)
+// Segmented iterator traits structure definition: deque iterators
+template <class T, class Reference, class Pointer>
+struct segmented_iterator_traits<std::_Deque_iterator<T, Reference, Pointer>>
+{
+    // Types
+    using is_segmented_iterator = std::true_type;
+    using iterator = std::_Deque_iterator<T, Reference, Pointer>;
+    using segment_iterator = typename iterator::_Map_pointer;
+    using local_iterator = Pointer;
+
+    // Decomposition
+    static segment_iterator segment(iterator it) noexcept
+    {
+        return it._M_node;
+    }
+    static local_iterator local(iterator it) noexcept
+    {
+        return it._M_cur;
+    }
+
+    // Segments
+    static local_iterator begin(segment_iterator it) noexcept
+    {
+        return *it;
+    }
+    static local_iterator end(segment_iterator it) noexcept
+    {
+        return *it + iterator::_S_buffer_size();
+    }
+};
+#endif
+/* ************************************************************************** */
+
+
+
+/* ********* IMPLEMENTATION DETAILS: CONTIGUOUS ITERATOR DETECTION ********** */
+// Contiguous iterator structure definition: pointers and vector iterators
+template <
+    class Iterator, 
+    class T = typename std::remove_cv<
+        typename std::iterator_traits<Iterator>::value_type
+    >::type
+>
+struct _is_contiguous_iterator
+: std::integral_constant<
+    bool,
+    std::is_pointer<Iterator>::value
+    || std::is_same<Iterator, typename std::vector<T>::iterator>::value
+    || std::is_same<Iterator, typename std::vector<T>::const_iterator>::value
+>
+{
+};
+/* ************************************************************************** */
+
+
+
 /* *********** IMPLEMENTATION DETAILS: NARROWEST AND WIDEST TYPES *********** */
 // Narrowest type structure declaration
 template <class... T>
@@ -261,6 +425,113 @@ using _wider_type_t = typename _wider_type<T>::type;
 // Assertions
 template <class Iterator>
 constexpr bool _assert_range_viability(Iterator first, Iterator last);
+
+// Constant evaluation
+constexpr bool _is_constant_evaluated() noexcept;
+
+// Word reading
+template <class Iterator>
+constexpr typename std::remove_cv<
+    typename _cv_iterator_traits<Iterator>::value_type
+>::type _read_word(Iterator it, std::size_t pos, std::size_t len);
+template <class T, class Iterator>
+constexpr T _read_chunk(Iterator& it, std::size_t pos, std::size_t len);
+
+// Word writing
+template <class Iterator>
+constexpr void _write_word(
+    Iterator it, 
+    std::size_t pos, 
+    std::size_t len,
+    typename _cv_iterator_traits<Iterator>::value_type src
+);
+/* ************************************************************************** */
+
+
+
+/* **************** IMPLEMENTATION DETAILS: INSTRUMENTATION ***************** */
+// Paths of the algorithms
+enum class _path {
+    aligned,
+    unaligned,
+    single_word
+};
+
+// Counters of an algorithm
+struct _algorithm_counters {
+    std::atomic<std::uint64_t> calls;
+    std::atomic<std::uint64_t> paths[3];
+    std::atomic<std::uint64_t> bits;
+    std::atomic<std::uint64_t> words;
+};
+
+// Counters of an instruction
+struct _instruction_counters {
+    std::atomic<std::uint64_t> hardware;
+    std::atomic<std::uint64_t> software;
+};
+
+// Counters of the library
+struct _instrumentation_counters {
+    _algorithm_counters count;
+    _algorithm_counters find;
+    _algorithm_counters copy;
+    _algorithm_counters fill;
+    _algorithm_counters reverse;
+    _instruction_counters popcnt;
+    _instruction_counters bitswap;
+    _instruction_counters pext;
+    _instruction_counters pdep;
+};
+
+// Storage
+inline _instrumentation_counters& _instrumentation() noexcept;
+
+// Recording
+template <class Iterator>
+constexpr _path _range_path(
+    bit_iterator<Iterator> first,
+    bit_iterator<Iterator> last
+) noexcept;
+template <class Iterator>
+void _record(
+    _algorithm_counters& counters,
+    _path path,
+    bit_iterator<Iterator> first,
+    bit_iterator<Iterator> last
+) noexcept;
+inline void _record(_instruction_counters& counters, bool is_hardware) noexcept;
+
+// Snapshots
+inline algorithm_stats _snapshot(const _algorithm_counters& counters) noexcept;
+inline instruction_stats _snapshot(
+    const _instruction_counters& counters
+) noexcept;
+inline void _reset(_algorithm_counters& counters) noexcept;
+inline void _reset(_instruction_counters& counters) noexcept;
+/* ************************************************************************** */
+
+
+
+/* ****************** IMPLEMENTATION DETAILS: CPU FEATURES ****************** */
+// Instruction set extensions
+enum class _isa {
+    popcnt, 
+    lzcnt, 
+    bmi, 
+    bmi2, 
+    avx2, 
+    avx512f, 
+    avx512bw, 
+    avx512vpopcntdq, 
+    gfni
+};
+
+// Runtime detection
+inline bool _cpu_supports(_isa isa) noexcept;
+
+// Fast parallel bits deposit and extract
+inline bool _has_fast_pdep() noexcept;
 /* ************************************************************************** */
 
 
@@ -291,14 +562,28 @@ template <class T, class... X>
 constexpr T _bextr(T src, T start, T len, X...) noexcept;
 
 // Parallel bits deposit
-template <class T, class = decltype(_pdep_u64(T()))>
+#if defined(__BMI2__) && !defined(BIT_SLOW_PDEP) \
+ || defined(_BIT_RUNTIME_DISPATCH)
+template <class T, class = decltype(_pdep_u64(T(), T()))>
 constexpr T _pdep(T src, T msk) noexcept;
+_BIT_TARGET("bmi2")
+inline std::uint32_t _pdep_bmi2(std::uint32_t src, std::uint32_t msk) noexcept;
+_BIT_TARGET("bmi2")
+inline std::uint64_t _pdep_bmi2(std::uint64_t src, std::uint64_t msk) noexcept;
+#endif
 template <class T, class... X>
 constexpr T _pdep(T src, T msk, X...) noexcept;
 
 // Parallel bits extract
-template <class T, class = decltype(_pext_u64(T()))>
+#if defined(__BMI2__) && !defined(BIT_SLOW_PDEP) \
+ || defined(_BIT_RUNTIME_DISPATCH)
+template <class T, class = decltype(_pext_u64(T(), T()))>
 constexpr T _pext(T src, T msk) noexcept;
+_BIT_TARGET("bmi2")
+inline std::uint32_t _pext_bmi2(std::uint32_t src, std::uint32_t msk) noexcept;
+_BIT_TARGET("bmi2")
+inline std::uint64_t _pext_bmi2(std::uint64_t src, std::uint64_t msk) noexcept;
+#endif
 template <class T, class... X>
 constexpr T _pext(T src, T msk, X...) noexcept;
 
@@ -359,10 +644,213 @@ template <class T, class T128 = decltype(__uint128_t(T()))>
 constexpr T _mulx(T src0, T src1, T* hi) noexcept;
 template <class T, class... X>
 constexpr T _mulx(T src0, T src1, T* hi, X...) noexcept;
+
+// Vector population count
+template <class T>
+std::size_t _vpopcnt(const T* first, const T* last) noexcept;
+template <class T, class... X>
+std::size_t _vpopcnt(const T* first, const T* last, X...) noexcept;
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__) \
+ || defined(_BIT_RUNTIME_DISPATCH)
+template <class T> _BIT_TARGET("avx512f,avx512vpopcntdq")
+std::size_t _vpopcnt_avx512(const T* first, const T* last) noexcept;
+#endif
+#if defined(__AVX2__) || defined(_BIT_RUNTIME_DISPATCH)
+template <class T> _BIT_TARGET("avx2")
+std::size_t _vpopcnt_avx2(const T* first, const T* last) noexcept;
+#endif
+#if defined(_BIT_RUNTIME_DISPATCH)
+template <class T> _BIT_TARGET("popcnt")
+std::size_t _vpopcnt_popcnt(const T* first, const T* last) noexcept;
+#endif
+
+// Vector bit swap
+template <class T>
+void _vbitswap(T* first, T* last) noexcept;
+template <class T, class... X>
+void _vbitswap(T* first, T* last, X...) noexcept;
+#if defined(__AVX512F__) && defined(__AVX512BW__) \
+ || defined(_BIT_RUNTIME_DISPATCH)
+template <class T> _BIT_TARGET("avx512f,avx512bw")
+void _vbitswap_avx512(T* first, T* last) noexcept;
+#endif
+#if defined(__AVX2__) || defined(_BIT_RUNTIME_DISPATCH)
+template <class T> _BIT_TARGET("avx2")
+void _vbitswap_avx2(T* first, T* last) noexcept;
+#endif
 /* ************************************************************************** */
 
 
 
+// ------------------------ INSTRUMENTATION: QUERIES ------------------------ //
+// Returns a snapshot of the counters, all zeros without BIT_INSTRUMENTATION
+inline instrumentation_stats instrumentation(
+) noexcept
+{
+    const _instrumentation_counters& counters = _instrumentation();
+    instrumentation_stats stats = {};
+#if defined(_BIT_INSTRUMENTATION)
+    stats.enabled = true;
+#endif
+#if defined(__POPCNT__)
+    stats.compiled.popcnt = true;
+#endif
+#if defined(__BMI2__) && !defined(BIT_SLOW_PDEP)
+    stats.compiled.bmi2 = true;
+#endif
+#if defined(__AVX2__)
+    stats.compiled.avx2 = true;
+#endif
+#if defined(__AVX512F__)
+    stats.compiled.avx512 = true;
+#endif
+#if defined(_BIT_RUNTIME_DISPATCH)
+    stats.compiled.runtime_dispatch = true;
+#endif
+    stats.count = _snapshot(counters.count);
+    stats.find = _snapshot(counters.find);
+    stats.copy = _snapshot(counters.copy);
+    stats.fill = _snapshot(counters.fill);
+    stats.reverse = _snapshot(counters.reverse);
+    stats.popcnt = _snapshot(counters.popcnt);
+    stats.bitswap = _snapshot(counters.bitswap);
+    stats.pext = _snapshot(counters.pext);
+    stats.pdep = _snapshot(counters.pdep);
+    return stats;
+}
+
+// Resets all the counters to zero
+inline void reset_instrumentation(
+) noexcept
+{
+    _instrumentation_counters& counters = _instrumentation();
+    _reset(counters.count);
+    _reset(counters.find);
+    _reset(counters.copy);
+    _reset(counters.fill);
+    _reset(counters.reverse);
+    _reset(counters.popcnt);
+    _reset(counters.bitswap);
+    _reset(counters.pext);
+    _reset(counters.pdep);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------ IMPLEMENTATION DETAILS: INSTRUMENTATION: STORAGE ------------ //
+// Returns the counters shared by all the threads, zero-initialized statically
+inline _instrumentation_counters& _instrumentation(
+) noexcept
+{
+    static _instrumentation_counters counters;
+    return counters;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------- IMPLEMENTATION DETAILS: INSTRUMENTATION: RECORDING ----------- //
+// Classifies a range by the position of its bits in the underlying words
+template <class Iterator>
+constexpr _path _range_path(
+    bit_iterator<Iterator> first,
+    bit_iterator<Iterator> last
+) noexcept
+{
+    return first.base() == last.base() ? _path::single_word
+         : first.position() == 0 && last.position() == 0 ? _path::aligned
+         : _path::unaligned;
+}
+
+// Records a call of an algorithm taking a path over a range
+template <class Iterator>
+void _record(
+    _algorithm_counters& counters,
+    _path path,
+    bit_iterator<Iterator> first,
+    bit_iterator<Iterator> last
+) noexcept
+{
+    constexpr auto relaxed = std::memory_order_relaxed;
+    const std::uint64_t bits = std::distance(first, last);
+    const std::uint64_t words = std::distance(first.base(), last.base())
+                              + (last.position() != 0);
+    counters.calls.fetch_add(1, relaxed);
+    counters.paths[static_cast<std::size_t>(path)].fetch_add(1, relaxed);
+    counters.bits.fetch_add(bits, relaxed);
+    counters.words.fetch_add(words, relaxed);
+}
+
+// Records a call of an instruction through hardware or software
+inline void _record(
+    _instruction_counters& counters,
+    bool is_hardware
+) noexcept
+{
+    constexpr auto relaxed = std::memory_order_relaxed;
+    (is_hardware ? counters.hardware : counters.software).fetch_add(1, relaxed);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------- IMPLEMENTATION DETAILS: INSTRUMENTATION: SNAPSHOTS ----------- //
+// Loads the counters of an algorithm
+inline algorithm_stats _snapshot(
+    const _algorithm_counters& counters
+) noexcept
+{
+    constexpr auto relaxed = std::memory_order_relaxed;
+    algorithm_stats stats = {};
+    stats.calls = counters.calls.load(relaxed);
+    stats.aligned = counters.paths[0].load(relaxed);
+    stats.unaligned = counters.paths[1].load(relaxed);
+    stats.single_word = counters.paths[2].load(relaxed);
+    stats.bits = counters.bits.load(relaxed);
+    stats.words = counters.words.load(relaxed);
+    return stats;
+}
+
+// Loads the counters of an instruction
+inline instruction_stats _snapshot(
+    const _instruction_counters& counters
+) noexcept
+{
+    constexpr auto relaxed = std::memory_order_relaxed;
+    instruction_stats stats = {};
+    stats.hardware = counters.hardware.load(relaxed);
+    stats.software = counters.software.load(relaxed);
+    return stats;
+}
+
+// Resets the counters of an algorithm
+inline void _reset(
+    _algorithm_counters& counters
+) noexcept
+{
+    constexpr auto relaxed = std::memory_order_relaxed;
+    counters.calls.store(0, relaxed);
+    for (std::atomic<std::uint64_t>& path: counters.paths) {
+        path.store(0, relaxed);
+    }
+    counters.bits.store(0, relaxed);
+    counters.words.store(0, relaxed);
+}
+
+// Resets the counters of an instruction
+inline void _reset(
+    _instruction_counters& counters
+) noexcept
+{
+    constexpr auto relaxed = std::memory_order_relaxed;
+    counters.hardware.store(0, relaxed);
+    counters.software.store(0, relaxed);
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // ------------- IMPLEMENTATION DETAILS: UTILITIES: ASSERTIONS -------------- //
 // If the range allows multipass iteration, checks if last - first >= 0
 template <class Iterator>
@@ -380,6 +868,152 @@ constexpr bool _assert_range_viability(Iterator first, Iterator last)
 
 
 
+// --------- IMPLEMENTATION DETAILS: UTILITIES: CONSTANT EVALUATION --------- //
+// Checks whether the call is evaluated as part of a constant expression
+constexpr bool _is_constant_evaluated() noexcept
+{
+#if defined(_BIT_CONSTANT_EVALUATION)
+    return __builtin_is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------ IMPLEMENTATION DETAILS: UTILITIES: WORD READING ------------- //
+// Reads len bits starting at pos in the lsbs, the other bits being unspecified
+template <class Iterator>
+constexpr typename std::remove_cv<
+    typename _cv_iterator_traits<Iterator>::value_type
+>::type _read_word(Iterator it, std::size_t pos, std::size_t len)
+{
+    using word_type = typename std::remove_cv<
+        typename _cv_iterator_traits<Iterator>::value_type
+    >::type;
+    constexpr std::size_t digits = binary_digits<word_type>::value;
+    return pos + len > digits 
+         ? _shrd<word_type>(*it, *std::next(it), pos)
+         : static_cast<word_type>(*it >> pos);
+}
+
+// Reads a chunk of len bits starting at pos, the other bits being zeros, and
+// advances the iterator past the complete words read: complete chunks are
+// gathered from whole words and then realigned with a single shift
+template <class T, class Iterator>
+constexpr T _read_chunk(Iterator& it, std::size_t pos, std::size_t len)
+{
+    using word_type = typename std::remove_cv<
+        typename _cv_iterator_traits<Iterator>::value_type
+    >::type;
+    constexpr std::size_t digits = binary_digits<word_type>::value;
+    constexpr std::size_t width = binary_digits<T>::value;
+    static_assert(width % digits == 0, "");
+    T dst = T();
+    word_type src = word_type();
+    std::size_t cnt = 0;
+    if (len == width) {
+        for (std::size_t i = 0; i < width; i += digits) {
+            dst |= static_cast<T>(*it) << i;
+            ++it;
+        }
+        if (pos != 0) {
+            dst = _shrd<T>(dst, static_cast<T>(*it), pos);
+        }
+    } else {
+        for (std::size_t i = 0; i < len; i += cnt) {
+            cnt = std::min(digits, len - i);
+            src = _bextr<word_type>(_read_word(it, pos, cnt), 0, cnt);
+            dst |= static_cast<T>(src) << i;
+            if (cnt == digits) {
+                ++it;
+            }
+        }
+    }
+    return dst;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------ IMPLEMENTATION DETAILS: UTILITIES: WORD WRITING ------------- //
+// Writes the len lsbs of src starting at pos, the other bits being preserved
+template <class Iterator>
+constexpr void _write_word(
+    Iterator it, 
+    std::size_t pos, 
+    std::size_t len,
+    typename _cv_iterator_traits<Iterator>::value_type src
+)
+{
+    using word_type = typename _cv_iterator_traits<Iterator>::value_type;
+    constexpr std::size_t digits = binary_digits<word_type>::value;
+    if (pos + len > digits) {
+        *it = _bitblend<word_type>(*it, src << pos, pos, digits - pos);
+        it = std::next(it);
+        *it = _bitblend<word_type>(
+            *it, 
+            src >> (digits - pos), 
+            0, 
+            pos + len - digits
+        );
+    } else if (len == digits) {
+        *it = src;
+    } else {
+        *it = _bitblend<word_type>(*it, src << pos, pos, len);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------- IMPLEMENTATION DETAILS: CPU FEATURES: RUNTIME DETECTION --------- //
+// Checks whether the processor supports an instruction set at runtime
+inline bool _cpu_supports(_isa isa) noexcept
+{
+    bool dst = false;
+#if defined(_BIT_RUNTIME_DISPATCH)
+    __builtin_cpu_init();
+    switch (isa) {
+        case _isa::popcnt: dst = __builtin_cpu_supports("popcnt"); break;
+        case _isa::lzcnt: dst = __builtin_cpu_supports("lzcnt"); break;
+        case _isa::bmi: dst = __builtin_cpu_supports("bmi"); break;
+        case _isa::bmi2: dst = __builtin_cpu_supports("bmi2"); break;
+        case _isa::avx2: dst = __builtin_cpu_supports("avx2"); break;
+        case _isa::avx512f: dst = __builtin_cpu_supports("avx512f"); break;
+        case _isa::avx512bw: dst = __builtin_cpu_supports("avx512bw"); break;
+        case _isa::avx512vpopcntdq: 
+            dst = __builtin_cpu_supports("avx512vpopcntdq"); 
+            break;
+        case _isa::gfni: dst = __builtin_cpu_supports("gfni"); break;
+    }
+#else
+    static_cast<void>(isa);
+#endif
+    return dst;
+}
+
+// Checks whether pdep and pext are both available and not microcoded
+inline bool _has_fast_pdep() noexcept
+{
+#if defined(BIT_SLOW_PDEP)
+    return false;
+#elif defined(_BIT_RUNTIME_DISPATCH)
+    static const bool dst = _cpu_supports(_isa::bmi2)
+        && !__builtin_cpu_is("znver1")
+        && !__builtin_cpu_is("znver2");
+    return dst;
+#elif defined(__BMI2__)
+    return true;
+#else
+    return false;
+#endif
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // --------- IMPLEMENTATION DETAILS: INSTRUCTIONS: POPULATION COUNT --------- //
 // Counts the number of bits set to 1 with compiler intrinsics
 template <class T, class>
@@ -512,7 +1146,9 @@ constexpr T _bextr(T src, T start, T len) noexcept
     static_assert(binary_digits<T>::value, "");
     constexpr T digits = binary_digits<T>::value;
     T dst = T();
-    if (digits <= std::numeric_limits<unsigned int>::digits) {
+    if (_is_constant_evaluated()) {
+        dst = _bextr(src, start, len, std::ignore);
+    } else if (digits <= std::numeric_limits<unsigned int>::digits) {
         dst = __builtin_ia32_bextr_u32(src, start, len); 
     } else if (digits <= std::numeric_limits<unsigned long long int>::digits) {
         dst = __builtin_ia32_bextr_u64(src, start, len);
@@ -529,7 +1165,7 @@ constexpr T _bextr(T src, T start, T len, X...) noexcept
     static_assert(binary_digits<T>::value, "");
     constexpr T digits = binary_digits<T>::value;
     constexpr T one = 1;
-    const T msk = (one << len) * (len < digits) - one;
+    const T msk = (one << (len % digits)) * (len < digits) - one;
     return (src >> start) & msk * (start < digits);
 }
 // -------------------------------------------------------------------------- //
@@ -537,41 +1173,70 @@ constexpr T _bextr(T src, T start, T len, X...) noexcept
 
 
 // ------- IMPLEMENTATION DETAILS: INSTRUCTIONS: PARALLEL BIT DEPOSIT ------- //
-// Deposits bits according to a mask with compiler instrinsics
+#if defined(__BMI2__) && !defined(BIT_SLOW_PDEP) \
+ || defined(_BIT_RUNTIME_DISPATCH)
+// Deposits bits according to a mask with compiler instrinsics when fast
 template <class T, class>
 constexpr T _pdep(T src, T msk) noexcept
 {
     static_assert(binary_digits<T>::value, "");
     constexpr T digits = binary_digits<T>::value;
     T dst = T();
-    if (digits <= std::numeric_limits<unsigned int>::digits) {
-        dst = _pdep_u32(src, msk); 
-    } else if (digits <= std::numeric_limits<unsigned long long int>::digits) {
-        dst = _pdep_u64(src, msk);
+    if (_is_constant_evaluated() || !_has_fast_pdep()) {
+        dst = _pdep(src, msk, std::ignore);
+    } else if (digits <= std::numeric_limits<std::uint32_t>::digits) {
+        dst = _pdep_bmi2(
+            static_cast<std::uint32_t>(src), 
+            static_cast<std::uint32_t>(msk)
+        );
+    } else if (digits <= std::numeric_limits<std::uint64_t>::digits) {
+        dst = _pdep_bmi2(
+            static_cast<std::uint64_t>(src), 
+            static_cast<std::uint64_t>(msk)
+        );
     } else {
         dst = _pdep(src, msk, std::ignore);
     }
     return dst;
 }
 
-// Deposits bits according to a mask without compiler instrinsics
+// Deposits the bits of a 32-bit word with bmi2
+_BIT_TARGET("bmi2")
+inline std::uint32_t _pdep_bmi2(std::uint32_t src, std::uint32_t msk) noexcept
+{
+    _BIT_RECORD(pdep, true);
+    return _pdep_u32(src, msk);
+}
+
+// Deposits the bits of a 64-bit word with bmi2
+_BIT_TARGET("bmi2")
+inline std::uint64_t _pdep_bmi2(std::uint64_t src, std::uint64_t msk) noexcept
+{
+    _BIT_RECORD(pdep, true);
+    return _pdep_u64(src, msk);
+}
+#endif
+
+// Deposits bits according to a mask one run of contiguous mask bits at a time
 template <class T, class... X>
 constexpr T _pdep(T src, T msk, X...) noexcept
 {
     static_assert(binary_digits<T>::value, "");
     constexpr T digits = binary_digits<T>::value;
+    constexpr T ones = static_cast<T>(~T());
     T dst = T();
-    T cnt = T();
+    T pos = T();
+    T len = T();
+    T run = T();
+    _BIT_RECORD(pdep, false);
     while (msk) {
-        dst >>= 1;
-        if (msk & 1) {
-            dst |= src << (digits - 1);
-            src >>= 1;
-        }
-        msk >>= 1;
-        ++cnt;
+        pos = _tzcnt(msk);
+        len = _tzcnt(static_cast<T>(~(msk >> pos)));
+        run = len < digits ? static_cast<T>((T(1) << len) - T(1)) : ones;
+        dst |= static_cast<T>((src & run) << pos);
+        src = len < digits ? static_cast<T>(src >> len) : T();
+        msk &= static_cast<T>(~(run << pos));
     }
-    dst >>= (digits - cnt) * (cnt > 0);
     return dst;
 }
 // -------------------------------------------------------------------------- //
@@ -579,41 +1244,71 @@ constexpr T _pdep(T src, T msk, X...) noexcept
 
 
 // ------- IMPLEMENTATION DETAILS: INSTRUCTIONS: PARALLEL BIT EXTRACT ------- //
-// Extracts bits according to a mask with compiler instrinsics
+#if defined(__BMI2__) && !defined(BIT_SLOW_PDEP) \
+ || defined(_BIT_RUNTIME_DISPATCH)
+// Extracts bits according to a mask with compiler instrinsics when fast
 template <class T, class>
 constexpr T _pext(T src, T msk) noexcept
 {
     static_assert(binary_digits<T>::value, "");
     constexpr T digits = binary_digits<T>::value;
     T dst = T();
-    if (digits <= std::numeric_limits<unsigned int>::digits) {
-        dst = _pext_u32(src, msk); 
-    } else if (digits <= std::numeric_limits<unsigned long long int>::digits) {
-        dst = _pext_u64(src, msk);
+    if (_is_constant_evaluated() || !_has_fast_pdep()) {
+        dst = _pext(src, msk, std::ignore);
+    } else if (digits <= std::numeric_limits<std::uint32_t>::digits) {
+        dst = _pext_bmi2(
+            static_cast<std::uint32_t>(src), 
+            static_cast<std::uint32_t>(msk)
+        );
+    } else if (digits <= std::numeric_limits<std::uint64_t>::digits) {
+        dst = _pext_bmi2(
+            static_cast<std::uint64_t>(src), 
+            static_cast<std::uint64_t>(msk)
+        );
     } else {
         dst = _pext(src, msk, std::ignore);
     }
     return dst;
 }
 
-// Extracts bits according to a mask without compiler instrinsics
+// Extracts the bits of a 32-bit word with bmi2
+_BIT_TARGET("bmi2")
+inline std::uint32_t _pext_bmi2(std::uint32_t src, std::uint32_t msk) noexcept
+{
+    _BIT_RECORD(pext, true);
+    return _pext_u32(src, msk);
+}
+
+// Extracts the bits of a 64-bit word with bmi2
+_BIT_TARGET("bmi2")
+inline std::uint64_t _pext_bmi2(std::uint64_t src, std::uint64_t msk) noexcept
+{
+    _BIT_RECORD(pext, true);
+    return _pext_u64(src, msk);
+}
+#endif
+
+// Extracts bits according to a mask one run of contiguous mask bits at a time
 template <class T, class... X>
 constexpr T _pext(T src, T msk, X...) noexcept
 {
     static_assert(binary_digits<T>::value, "");
     constexpr T digits = binary_digits<T>::value;
+    constexpr T ones = static_cast<T>(~T());
     T dst = T();
     T cnt = T();
+    T pos = T();
+    T len = T();
+    T run = T();
+    _BIT_RECORD(pext, false);
     while (msk) {
-        if (msk & 1) {
-            dst >>= 1;
-            dst |= src << (digits - 1);
-            ++cnt;
-        }
-        src >>= 1;
-        msk >>= 1;
+        pos = _tzcnt(msk);
+        len = _tzcnt(static_cast<T>(~(msk >> pos)));
+        run = len < digits ? static_cast<T>((T(1) << len) - T(1)) : ones;
+        dst |= static_cast<T>(((src >> pos) & run) << cnt);
+        cnt += len;
+        msk &= static_cast<T>(~(run << pos));
     }
-    dst >>= (digits - cnt) * (cnt > 0);
     return dst;
 }
 // -------------------------------------------------------------------------- //
@@ -961,6 +1656,353 @@ constexpr T _mulx(T src0, T src1, T* hi, X...) noexcept
 
 
 
+// ----- IMPLEMENTATION DETAILS: INSTRUCTIONS: VECTOR POPULATION COUNT ------ //
+// Counts the number of bits set to 1 in contiguous words with the best kernel
+template <class T>
+std::size_t _vpopcnt(const T* first, const T* last) noexcept
+{
+    static_assert(binary_digits<T>::value, "");
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+    _BIT_RECORD(popcnt, true);
+    return _vpopcnt_avx512(first, last);
+#elif defined(_BIT_RUNTIME_DISPATCH)
+    using kernel_t = std::size_t (*)(const T*, const T*);
+    _BIT_RECORD(popcnt, _cpu_supports(_isa::popcnt));
+    static const kernel_t kernel
+        = _cpu_supports(_isa::avx512f) && _cpu_supports(_isa::avx512vpopcntdq)
+        ? kernel_t(&_vpopcnt_avx512<T>)
+        : _cpu_supports(_isa::avx2) ? kernel_t(&_vpopcnt_avx2<T>)
+        : _cpu_supports(_isa::popcnt) ? kernel_t(&_vpopcnt_popcnt<T>)
+        : kernel_t([](const T* f, const T* l) noexcept {
+            return _vpopcnt(f, l, std::ignore);
+        });
+    return kernel(first, last);
+#elif defined(__AVX2__)
+    _BIT_RECORD(popcnt, true);
+    return _vpopcnt_avx2(first, last);
+#else
+    _BIT_RECORD(popcnt, false);
+    return _vpopcnt(first, last, std::ignore);
+#endif
+}
+
+// Counts the number of bits set to 1 in contiguous words without vectors
+template <class T, class... X>
+std::size_t _vpopcnt(const T* first, const T* last, X...) noexcept
+{
+    static_assert(binary_digits<T>::value, "");
+    std::size_t dst = 0;
+    for (; first != last; ++first) {
+        dst += _popcnt(*first);
+    }
+    return dst;
+}
+
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__) \
+ || defined(_BIT_RUNTIME_DISPATCH)
+// Counts the number of bits set to 1 in contiguous words with avx512 vpopcntq
+template <class T> _BIT_TARGET("avx512f,avx512vpopcntdq")
+std::size_t _vpopcnt_avx512(const T* first, const T* last) noexcept
+{
+    static_assert(binary_digits<T>::value, "");
+    using byte_t = unsigned char;
+    constexpr std::size_t digits = binary_digits<T>::value;
+    constexpr std::size_t bytes = sizeof(__m512i);
+    constexpr std::size_t step = bytes / sizeof(T);
+    constexpr std::size_t bits = std::numeric_limits<byte_t>::digits;
+    constexpr bool is_dense = digits == sizeof(T) * bits;
+    constexpr bool is_divisor = bytes % sizeof(T) == 0;
+    __m512i acc0 = _mm512_setzero_si512();
+    __m512i acc1 = _mm512_setzero_si512();
+    std::size_t dst = 0;
+    if (!is_dense || !is_divisor) {
+        return _vpopcnt(first, last, std::ignore);
+    }
+    const std::size_t size = (last - first) / (step * 2) * (step * 2);
+    const T* const end = first + size;
+    for (; first != end; first += step * 2) {
+        acc0 = _mm512_add_epi64(acc0, _mm512_popcnt_epi64(_mm512_loadu_si512(
+            reinterpret_cast<const void*>(first)
+        )));
+        acc1 = _mm512_add_epi64(acc1, _mm512_popcnt_epi64(_mm512_loadu_si512(
+            reinterpret_cast<const void*>(first + step)
+        )));
+    }
+    std::uint64_t lanes[sizeof(__m512i) / sizeof(std::uint64_t)] = {};
+    _mm512_storeu_si512(lanes, _mm512_add_epi64(acc0, acc1));
+    for (std::uint64_t lane: lanes) {
+        dst += lane;
+    }
+    return dst + _vpopcnt(first, last, std::ignore);
+}
+#endif
+
+#if defined(__AVX2__) || defined(_BIT_RUNTIME_DISPATCH)
+// Counts the number of bits set to 1 in each 64-bit lane with avx2 pshufb
+_BIT_TARGET("avx2") inline __m256i _vpopcnt_lanes(__m256i src) noexcept
+{
+    const __m256i table = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+    );
+    const __m256i msk = _mm256_set1_epi8(0x0F);
+    const __m256i lo = _mm256_shuffle_epi8(table, _mm256_and_si256(src, msk));
+    const __m256i hi = _mm256_shuffle_epi8(
+        table, 
+        _mm256_and_si256(_mm256_srli_epi16(src, 4), msk)
+    );
+    return _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256());
+}
+
+// Carry-save adder used by the harley-seal population count
+_BIT_TARGET("avx2") inline void _vpopcnt_csa(
+    __m256i* hi, 
+    __m256i* lo, 
+    __m256i src0, 
+    __m256i src1, 
+    __m256i src2
+) noexcept
+{
+    const __m256i tmp = _mm256_xor_si256(src0, src1);
+    *hi = _mm256_or_si256(
+        _mm256_and_si256(src0, src1), 
+        _mm256_and_si256(tmp, src2)
+    );
+    *lo = _mm256_xor_si256(tmp, src2);
+}
+
+// Counts the number of bits set to 1 in contiguous words with avx2 pshufb
+template <class T> _BIT_TARGET("avx2")
+std::size_t _vpopcnt_avx2(const T* first, const T* last) noexcept
+{
+    static_assert(binary_digits<T>::value, "");
+    using byte_t = unsigned char;
+    constexpr std::size_t digits = binary_digits<T>::value;
+    constexpr std::size_t bytes = sizeof(__m256i);
+    constexpr std::size_t step = bytes / sizeof(T);
+    constexpr std::size_t bits = std::numeric_limits<byte_t>::digits;
+    constexpr bool is_dense = digits == sizeof(T) * bits;
+    constexpr bool is_divisor = bytes % sizeof(T) == 0;
+    const __m256i* src = reinterpret_cast<const __m256i*>(first);
+    const std::size_t size = is_dense && is_divisor ? (last - first) / step : 0;
+    __m256i total = _mm256_setzero_si256();
+    __m256i ones = _mm256_setzero_si256();
+    __m256i twos = _mm256_setzero_si256();
+    __m256i fours = _mm256_setzero_si256();
+    __m256i eights = _mm256_setzero_si256();
+    __m256i sixteens = _mm256_setzero_si256();
+    __m256i twos_a = {};
+    __m256i twos_b = {};
+    __m256i fours_a = {};
+    __m256i fours_b = {};
+    __m256i eights_a = {};
+    __m256i eights_b = {};
+    std::size_t i = 0;
+    std::size_t dst = 0;
+    for (; i + 16 <= size; i += 16) {
+        _vpopcnt_csa(&twos_a, &ones, ones, 
+            _mm256_loadu_si256(src + i), _mm256_loadu_si256(src + i + 1));
+        _vpopcnt_csa(&twos_b, &ones, ones, 
+            _mm256_loadu_si256(src + i + 2), _mm256_loadu_si256(src + i + 3));
+        _vpopcnt_csa(&fours_a, &twos, twos, twos_a, twos_b);
+        _vpopcnt_csa(&twos_a, &ones, ones,
+            _mm256_loadu_si256(src + i + 4), _mm256_loadu_si256(src + i + 5));
+        _vpopcnt_csa(&twos_b, &ones, ones,
+            _mm256_loadu_si256(src + i + 6), _mm256_loadu_si256(src + i + 7));
+        _vpopcnt_csa(&fours_b, &twos, twos, twos_a, twos_b);
+        _vpopcnt_csa(&eights_a, &fours, fours, fours_a, fours_b);
+        _vpopcnt_csa(&twos_a, &ones, ones,
+            _mm256_loadu_si256(src + i + 8), _mm256_loadu_si256(src + i + 9));
+        _vpopcnt_csa(&twos_b, &ones, ones,
+            _mm256_loadu_si256(src + i + 10), _mm256_loadu_si256(src + i + 11));
+        _vpopcnt_csa(&fours_a, &twos, twos, twos_a, twos_b);
+        _vpopcnt_csa(&twos_a, &ones, ones,
+            _mm256_loadu_si256(src + i + 12), _mm256_loadu_si256(src + i + 13));
+        _vpopcnt_csa(&twos_b, &ones, ones,
+            _mm256_loadu_si256(src + i + 14), _mm256_loadu_si256(src + i + 15));
+        _vpopcnt_csa(&fours_b, &twos, twos, twos_a, twos_b);
+        _vpopcnt_csa(&eights_b, &fours, fours, fours_a, fours_b);
+        _vpopcnt_csa(&sixteens, &eights, eights, eights_a, eights_b);
+        total = _mm256_add_epi64(total, _vpopcnt_lanes(sixteens));
+    }
+    total = _mm256_slli_epi64(total, 4);
+    total = _mm256_add_epi64(total, 
+        _mm256_slli_epi64(_vpopcnt_lanes(eights), 3));
+    total = _mm256_add_epi64(total, 
+        _mm256_slli_epi64(_vpopcnt_lanes(fours), 2));
+    total = _mm256_add_epi64(total, 
+        _mm256_slli_epi64(_vpopcnt_lanes(twos), 1));
+    total = _mm256_add_epi64(total, _vpopcnt_lanes(ones));
+    for (; i < size; ++i) {
+        total = _mm256_add_epi64(total, 
+            _vpopcnt_lanes(_mm256_loadu_si256(src + i)));
+    }
+    dst = static_cast<std::uint64_t>(_mm256_extract_epi64(total, 0))
+        + static_cast<std::uint64_t>(_mm256_extract_epi64(total, 1))
+        + static_cast<std::uint64_t>(_mm256_extract_epi64(total, 2))
+        + static_cast<std::uint64_t>(_mm256_extract_epi64(total, 3));
+    return dst + _vpopcnt(first + size * step, last, std::ignore);
+}
+#endif
+
+#if defined(_BIT_RUNTIME_DISPATCH)
+// Counts the number of bits set to 1 in contiguous words with popcnt
+template <class T> _BIT_TARGET("popcnt")
+std::size_t _vpopcnt_popcnt(const T* first, const T* last) noexcept
+{
+    static_assert(binary_digits<T>::value, "");
+    std::size_t dst = 0;
+    for (; first != last; ++first) {
+        dst += _popcnt(*first);
+    }
+    return dst;
+}
+#endif
+// -------------------------------------------------------------------------- //
+
+
+
+// --------- IMPLEMENTATION DETAILS: INSTRUCTIONS: VECTOR BIT SWAP ---------- //
+// Reverses the order of the bits of contiguous words with the best kernel
+template <class T>
+void _vbitswap(T* first, T* last) noexcept
+{
+    static_assert(binary_digits<T>::value, "");
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+    _BIT_RECORD(bitswap, true);
+    _vbitswap_avx512(first, last);
+#elif defined(_BIT_RUNTIME_DISPATCH)
+    using kernel_t = void (*)(T*, T*);
+    _BIT_RECORD(bitswap, _cpu_supports(_isa::avx2));
+    static const kernel_t kernel
+        = _cpu_supports(_isa::avx512f) && _cpu_supports(_isa::avx512bw)
+        ? kernel_t(&_vbitswap_avx512<T>)
+        : _cpu_supports(_isa::avx2) ? kernel_t(&_vbitswap_avx2<T>)
+        : kernel_t([](T* f, T* l) noexcept {_vbitswap(f, l, std::ignore);});
+    kernel(first, last);
+#elif defined(__AVX2__)
+    _BIT_RECORD(bitswap, true);
+    _vbitswap_avx2(first, last);
+#else
+    _BIT_RECORD(bitswap, false);
+    _vbitswap(first, last, std::ignore);
+#endif
+}
+
+// Reverses the order of the bits of contiguous words one word at a time
+template <class T, class... X>
+void _vbitswap(T* first, T* last, X...) noexcept
+{
+    static_assert(binary_digits<T>::value, "");
+    for (; first != last; ++first) {
+        *first = _bitswap(*first);
+    }
+}
+
+#if defined(__AVX512F__) && defined(__AVX512BW__) \
+ || defined(_BIT_RUNTIME_DISPATCH)
+// Reverses the order of the bits of contiguous words with avx512 pshufb
+template <class T> _BIT_TARGET("avx512f,avx512bw")
+void _vbitswap_avx512(T* first, T* last) noexcept
+{
+    static_assert(binary_digits<T>::value, "");
+    using byte_t = unsigned char;
+    constexpr std::size_t digits = binary_digits<T>::value;
+    constexpr std::size_t bytes = sizeof(__m512i);
+    constexpr std::size_t step = bytes / sizeof(T);
+    constexpr std::size_t bits = std::numeric_limits<byte_t>::digits;
+    constexpr bool is_dense = digits == sizeof(T) * bits;
+    constexpr std::size_t lane = sizeof(__m128i);
+    constexpr bool is_divisor = lane % sizeof(T) == 0;
+    constexpr byte_t nibbles[lane] = {
+        0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE, 
+        0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF
+    };
+    byte_t table[bytes] = {};
+    byte_t order[bytes] = {};
+    for (std::size_t i = 0; i < bytes; ++i) {
+        table[i] = nibbles[i % lane];
+        order[i] = i / sizeof(T) * sizeof(T) + sizeof(T) - 1 - i % sizeof(T);
+    }
+    const __m512i lo_table = _mm512_loadu_si512(table);
+    const __m512i hi_table = _mm512_slli_epi16(lo_table, 4);
+    const __m512i msk = _mm512_set1_epi8(0x0F);
+    const __m512i swap = _mm512_loadu_si512(order);
+    __m512i src = {};
+    if (!is_dense || !is_divisor) {
+        return _vbitswap(first, last, std::ignore);
+    }
+    for (; last - first >= static_cast<std::ptrdiff_t>(step); first += step) {
+        src = _mm512_loadu_si512(first);
+        src = _mm512_shuffle_epi8(src, swap);
+        src = _mm512_or_si512(
+            _mm512_shuffle_epi8(hi_table, _mm512_and_si512(src, msk)),
+            _mm512_shuffle_epi8(
+                lo_table, 
+                _mm512_and_si512(_mm512_srli_epi16(src, 4), msk)
+            )
+        );
+        _mm512_storeu_si512(first, src);
+    }
+    _vbitswap(first, last, std::ignore);
+}
+#endif
+
+#if defined(__AVX2__) || defined(_BIT_RUNTIME_DISPATCH)
+// Reverses the order of the bits of contiguous words with avx2 pshufb
+template <class T> _BIT_TARGET("avx2")
+void _vbitswap_avx2(T* first, T* last) noexcept
+{
+    static_assert(binary_digits<T>::value, "");
+    using byte_t = unsigned char;
+    constexpr std::size_t digits = binary_digits<T>::value;
+    constexpr std::size_t bytes = sizeof(__m256i);
+    constexpr std::size_t step = bytes / sizeof(T);
+    constexpr std::size_t bits = std::numeric_limits<byte_t>::digits;
+    constexpr bool is_dense = digits == sizeof(T) * bits;
+    constexpr std::size_t lane = sizeof(__m128i);
+    constexpr bool is_divisor = lane % sizeof(T) == 0;
+    constexpr byte_t nibbles[lane] = {
+        0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE, 
+        0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF
+    };
+    byte_t table[bytes] = {};
+    byte_t order[bytes] = {};
+    for (std::size_t i = 0; i < bytes; ++i) {
+        table[i] = nibbles[i % lane];
+        order[i] = i / sizeof(T) * sizeof(T) + sizeof(T) - 1 - i % sizeof(T);
+    }
+    const __m256i lo_table = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(table)
+    );
+    const __m256i hi_table = _mm256_slli_epi16(lo_table, 4);
+    const __m256i msk = _mm256_set1_epi8(0x0F);
+    const __m256i swap = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(order)
+    );
+    __m256i src = {};
+    if (!is_dense || !is_divisor) {
+        return _vbitswap(first, last, std::ignore);
+    }
+    for (; last - first >= static_cast<std::ptrdiff_t>(step); first += step) {
+        src = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        src = _mm256_shuffle_epi8(src, swap);
+        src = _mm256_or_si256(
+            _mm256_shuffle_epi8(hi_table, _mm256_and_si256(src, msk)),
+            _mm256_shuffle_epi8(
+                lo_table, 
+                _mm256_and_si256(_mm256_srli_epi16(src, 4), msk)
+            )
+        );
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(first), src);
+    }
+    _vbitswap(first, last, std::ignore);
+}
+#endif
+// -------------------------------------------------------------------------- //
+
+
+
 // ========================================================================== //
 } // namespace bit
 #endif // _BIT_DETAILS_HPP_INCLUDED
@@ -0,0 +1,136 @@
+// ================================ BIT HASH ================================ //
+// Project:         The C++ Bit Library
+// Name:            bit_hash.hpp
+// Description:     Alignment independent hashing of ranges of bits
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2015-2017]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_HASH_HPP_INCLUDED
+#define _BIT_HASH_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cstdint>
+// Project sources
+#include "bit_details.hpp"
+#include "bit_value.hpp"
+#include "bit_reference.hpp"
+#include "bit_pointer.hpp"
+#include "bit_iterator.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* ******************************** HASHING ********************************* */
+// Ranges
+template <class InputIt>
+constexpr std::uint64_t hash(
+    bit_iterator<InputIt> first,
+    bit_iterator<InputIt> last,
+    std::uint64_t seed = 0
+);
+/* ************************************************************************** */
+
+
+
+/* ******************** IMPLEMENTATION DETAILS: HASHING ********************* */
+// Mixing
+constexpr std::uint64_t _hash_mix(
+    std::uint64_t src0,
+    std::uint64_t src1
+) noexcept;
+/* ************************************************************************** */
+
+
+
+// ---------------------------- HASHING: RANGES ----------------------------- //
+// Hashes the bits of a range two 64-bit chunks at a time, the chunks being
+// realigned on the fly so that equal sequences hash equally at any offset
+template <class InputIt>
+constexpr std::uint64_t hash(
+    bit_iterator<InputIt> first,
+    bit_iterator<InputIt> last,
+    std::uint64_t seed
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+
+    // Types and constants
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<InputIt>::word_type
+    >::type;
+    using size_type = typename bit_iterator<InputIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr size_type width = binary_digits<std::uint64_t>::value;
+    constexpr std::uint64_t secret0 = 0xA0761D6478BD642FULL;
+    constexpr std::uint64_t secret1 = 0xE7037ED1A0B428DBULL;
+    constexpr std::uint64_t secret2 = 0x8EBC6AF09C88C6E3ULL;
+    static_assert(width % digits == 0, "");
+
+    // Initialization
+    const size_type size = std::distance(first, last);
+    const size_type pos = first.position();
+    size_type n = size;
+    auto it = first.base();
+    std::uint64_t state = seed ^ _hash_mix(seed ^ secret0, secret1);
+    std::uint64_t other = state;
+    std::uint64_t lsbs = 0;
+    std::uint64_t msbs = 0;
+
+    // Mixes the chunks of long ranges in two independent lanes
+    if (n > 4 * width) {
+        for (; n > 4 * width; n -= 4 * width) {
+            lsbs = _read_chunk<std::uint64_t>(it, pos, width);
+            msbs = _read_chunk<std::uint64_t>(it, pos, width);
+            state = _hash_mix(lsbs ^ secret1, msbs ^ state);
+            lsbs = _read_chunk<std::uint64_t>(it, pos, width);
+            msbs = _read_chunk<std::uint64_t>(it, pos, width);
+            other = _hash_mix(lsbs ^ secret2, msbs ^ other);
+        }
+        state ^= other;
+    }
+
+    // Mixes the chunks of all bits but the last ones
+    for (; n > width + width; n -= width + width) {
+        lsbs = _read_chunk<std::uint64_t>(it, pos, width);
+        msbs = _read_chunk<std::uint64_t>(it, pos, width);
+        state = _hash_mix(lsbs ^ secret1, msbs ^ state);
+    }
+
+    // Mixes the last chunks, padded with zeros, and the size
+    lsbs = _read_chunk<std::uint64_t>(it, pos, std::min(n, width));
+    msbs = n > width ? _read_chunk<std::uint64_t>(it, pos, n - width) : 0;
+    state = _hash_mix(lsbs ^ secret1, msbs ^ state);
+    return _hash_mix(static_cast<std::uint64_t>(size) ^ secret1, state);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------- IMPLEMENTATION DETAILS: HASHING: MIXING ----------------- //
+// Mixes two chunks by folding their full 128-bit product
+constexpr std::uint64_t _hash_mix(
+    std::uint64_t src0,
+    std::uint64_t src1
+) noexcept
+{
+    std::uint64_t hi = 0;
+    const std::uint64_t lo = _mulx(src0, src1, &hi);
+    return lo ^ hi;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _BIT_HASH_HPP_INCLUDED
+// ========================================================================== //
@@ -80,6 +80,11 @@ class bit_iterator
     constexpr size_type position() const noexcept;
     constexpr typename std::remove_cv<word_type>::type mask() const noexcept;
 
+    // Implementation details: function members
+    private:
+    static constexpr difference_type _word_offset(difference_type n) noexcept;
+    static constexpr size_type _bit_offset(difference_type n) noexcept;
+
     // Implementation details: data members
     private:
     iterator_type _current;
@@ -224,13 +229,11 @@ bit_iterator<Iterator>::operator[](
     difference_type n
 ) const
 {
-    constexpr difference_type digits = binary_digits<word_type>::value;
-    const difference_type sum = _position + n;
-    difference_type diff = sum / digits;
-    if (sum < 0 && diff * digits != sum) {
-        --diff;
-    }
-    return reference(*std::next(_current, diff), sum - diff * digits);
+    const difference_type sum = static_cast<difference_type>(_position) + n;
+    return reference(
+        *std::next(_current, _word_offset(sum)),
+        _bit_offset(sum)
+    );
 }
 // -------------------------------------------------------------------------- //
 
@@ -295,13 +298,11 @@ constexpr bit_iterator<Iterator> bit_iterator<Iterator>::operator+(
     difference_type n
 ) const
 {
-    constexpr difference_type digits = binary_digits<word_type>::value;
-    const difference_type sum = _position + n;
-    difference_type diff = sum / digits;
-    if (sum < 0 && diff * digits != sum) {
-        --diff;
-    }
-    return bit_iterator(std::next(_current, diff), sum - diff * digits);
+    const difference_type sum = static_cast<difference_type>(_position) + n;
+    return bit_iterator(
+        std::next(_current, _word_offset(sum)),
+        _bit_offset(sum)
+    );
 }
 
 // Looks backward several bits and gets an iterator at this position
@@ -310,13 +311,11 @@ constexpr bit_iterator<Iterator> bit_iterator<Iterator>::operator-(
     difference_type n
 ) const
 {
-    constexpr difference_type digits = binary_digits<word_type>::value;
-    const difference_type sum = _position - n;
-    difference_type diff = sum / digits;
-    if (sum < 0 && diff * digits != sum) {
-        --diff;
-    }
-    return bit_iterator(std::next(_current, diff), sum - diff * digits);
+    const difference_type sum = static_cast<difference_type>(_position) - n;
+    return bit_iterator(
+        std::next(_current, _word_offset(sum)),
+        _bit_offset(sum)
+    );
 }
 
 // Increments the iterator by several bits and returns it
@@ -405,7 +404,9 @@ constexpr typename std::common_type<
     constexpr difference_type digits = rhs_digits;
     static_assert(lhs_digits == rhs_digits, "");
     const difference_type main = lhs._current - rhs._current;
-    return main * digits + (lhs._position - rhs._position);
+    const difference_type lhs_pos = lhs._position;
+    const difference_type rhs_pos = rhs._position;
+    return main * digits + (lhs_pos - rhs_pos);
 }
 // -------------------------------------------------------------------------- //
 
@@ -479,6 +480,39 @@ constexpr bool operator>=(
 
 
 
+// --------- BIT ITERATOR: IMPLEMENTATION DETAILS: FUNCTION MEMBERS --------- //
+// Returns the word offset of a bit offset, rounded towards negative infinity
+template <class Iterator>
+constexpr typename bit_iterator<Iterator>::difference_type
+bit_iterator<Iterator>::_word_offset(
+    difference_type n
+) noexcept
+{
+    constexpr auto ignore = nullptr;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr difference_type sdigits = digits;
+    constexpr bool is_pow2 = _popcnt(digits, ignore) == 1;
+    constexpr size_type shift = _popcnt(digits - 1, ignore);
+    return is_pow2 ? n >> shift : n / sdigits - (n % sdigits < 0);
+}
+
+// Returns the bit position of a bit offset within its word
+template <class Iterator>
+constexpr typename bit_iterator<Iterator>::size_type
+bit_iterator<Iterator>::_bit_offset(
+    difference_type n
+) noexcept
+{
+    constexpr auto ignore = nullptr;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr difference_type sdigits = digits;
+    constexpr bool is_pow2 = _popcnt(digits, ignore) == 1;
+    return is_pow2 ? n & (sdigits - 1) : n - _word_offset(n) * sdigits;
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // ========================================================================== //
 } // namespace bit
 #endif // _BIT_ITERATOR_HPP_INCLUDED
@@ -0,0 +1,519 @@
+// ============================ BIT MAPPED SPAN ============================= //
+// Project:         The C++ Bit Library
+// Name:            bit_mapped_span.hpp
+// Description:     A span of bits over a memory mapped file
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2015-2017]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_MAPPED_SPAN_HPP_INCLUDED
+#define _BIT_MAPPED_SPAN_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cerrno>
+#include <string>
+#include <stdexcept>
+#include <system_error>
+// Project sources
+#include "bit_details.hpp"
+#include "bit_value.hpp"
+#include "bit_reference.hpp"
+#include "bit_pointer.hpp"
+#include "bit_iterator.hpp"
+// Third-party libraries
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define _BIT_MEMORY_MAPPING
+#endif
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+#if defined(_BIT_MEMORY_MAPPING)
+/* **************************** MAPPED BIT SPAN ***************************** */
+// Access modes of a mapping
+enum class mapped_mode: unsigned char {
+    read_only,
+    read_write
+};
+
+// Access pattern hints of a mapping
+enum class mapped_advice: unsigned char {
+    normal,
+    sequential,
+    random,
+    will_need,
+    dont_need,
+    huge_pages
+};
+
+// Mapped bit span class definition
+template <class WordType, endian Endian = endian::native>
+class mapped_bit_span
+{
+    // Assertions
+    static_assert(binary_digits<WordType>::value, "");
+
+    // Types
+    public:
+    using word_type = WordType;
+    using value_type = bit_value;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = bit_reference<word_type>;
+    using const_reference = bit_reference<const word_type>;
+    using pointer = bit_pointer<word_type>;
+    using const_pointer = bit_pointer<const word_type>;
+    using iterator = bit_iterator<word_type*>;
+    using const_iterator = bit_iterator<const word_type*>;
+
+    // Lifecycle
+    public:
+    mapped_bit_span() noexcept;
+    explicit mapped_bit_span(
+        const std::string& path,
+        mapped_mode mode = mapped_mode::read_only
+    );
+    mapped_bit_span(const std::string& path, size_type count);
+    mapped_bit_span(const mapped_bit_span& other) = delete;
+    mapped_bit_span(mapped_bit_span&& other) noexcept;
+    ~mapped_bit_span();
+
+    // Assignment
+    public:
+    mapped_bit_span& operator=(const mapped_bit_span& other) = delete;
+    mapped_bit_span& operator=(mapped_bit_span&& other) noexcept;
+
+    // Element access
+    public:
+    reference operator[](size_type pos);
+    const_reference operator[](size_type pos) const;
+    word_type* data();
+    const word_type* data() const noexcept;
+
+    // Iterators
+    public:
+    iterator begin();
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    iterator end();
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    // Capacity
+    public:
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+
+    // Mapping
+    public:
+    bool is_open() const noexcept;
+    mapped_mode mode() const noexcept;
+    bool advise(mapped_advice advice) noexcept;
+    void sync();
+    void close() noexcept;
+    void swap(mapped_bit_span& other) noexcept;
+
+    // Implementation details: function members
+    private:
+    void _map(const std::string& path, int flags, size_type bytes);
+    void _check_writability() const;
+
+    // Implementation details: data members
+    private:
+    static constexpr size_type _digits = binary_digits<word_type>::value;
+    static constexpr bool _is_foreign = Endian != endian::native
+                                     && sizeof(word_type) > 1;
+    word_type* _data;
+    size_type _bytes;
+    size_type _size;
+    mapped_mode _mode;
+};
+
+// Swap
+template <class WordType, endian Endian>
+void swap(
+    mapped_bit_span<WordType, Endian>& lhs,
+    mapped_bit_span<WordType, Endian>& rhs
+) noexcept;
+/* ************************************************************************** */
+
+
+
+// ----------------------- MAPPED BIT SPAN: LIFECYCLE ----------------------- //
+// Implicitly default constructs a span that does not map any file
+template <class WordType, endian Endian>
+mapped_bit_span<WordType, Endian>::mapped_bit_span(
+) noexcept
+: _data(nullptr)
+, _bytes(0)
+, _size(0)
+, _mode(mapped_mode::read_only)
+{
+}
+
+// Maps an existing file, foreign byte orders being swapped in private pages,
+// which reads and copies the whole file before the constructor returns
+template <class WordType, endian Endian>
+mapped_bit_span<WordType, Endian>::mapped_bit_span(
+    const std::string& path,
+    mapped_mode mode
+)
+: mapped_bit_span()
+{
+    _mode = mode;
+    _map(path, mode == mapped_mode::read_only ? O_RDONLY : O_RDWR, 0);
+}
+
+// Maps a file for reading and writing, creating or resizing it to count bits,
+// the file being truncated to the words needed to hold them
+template <class WordType, endian Endian>
+mapped_bit_span<WordType, Endian>::mapped_bit_span(
+    const std::string& path,
+    size_type count
+)
+: mapped_bit_span()
+{
+    _mode = mapped_mode::read_write;
+    _map(path, O_RDWR | O_CREAT | (count == 0 ? O_TRUNC : 0),
+         (count + _digits - 1) / _digits * sizeof(word_type));
+    _size = count;
+}
+
+// Moves the mapping of another span, leaving it unmapped
+template <class WordType, endian Endian>
+mapped_bit_span<WordType, Endian>::mapped_bit_span(
+    mapped_bit_span&& other
+) noexcept
+: mapped_bit_span()
+{
+    swap(other);
+}
+
+// Unmaps the file, the changes of a shared mapping being kept by the system
+template <class WordType, endian Endian>
+mapped_bit_span<WordType, Endian>::~mapped_bit_span(
+)
+{
+    close();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- MAPPED BIT SPAN: ASSIGNMENT ----------------------- //
+// Unmaps the current file and moves the mapping of another span
+template <class WordType, endian Endian>
+mapped_bit_span<WordType, Endian>&
+mapped_bit_span<WordType, Endian>::operator=(
+    mapped_bit_span&& other
+) noexcept
+{
+    if (this != &other) {
+        close();
+        swap(other);
+    }
+    return *this;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- MAPPED BIT SPAN: ELEMENT ACCESS --------------------- //
+// Gets a reference to the bit at the provided position if writable
+template <class WordType, endian Endian>
+typename mapped_bit_span<WordType, Endian>::reference
+mapped_bit_span<WordType, Endian>::operator[](
+    size_type pos
+)
+{
+    _check_writability();
+    return reference(_data[pos / _digits], pos % _digits);
+}
+
+// Gets a constant reference to the bit at the provided position
+template <class WordType, endian Endian>
+typename mapped_bit_span<WordType, Endian>::const_reference
+mapped_bit_span<WordType, Endian>::operator[](
+    size_type pos
+) const
+{
+    return const_reference(_data[pos / _digits], pos % _digits);
+}
+
+// Returns a pointer to the mapped words if writable
+template <class WordType, endian Endian>
+typename mapped_bit_span<WordType, Endian>::word_type*
+mapped_bit_span<WordType, Endian>::data(
+)
+{
+    _check_writability();
+    return _data;
+}
+
+// Returns a constant pointer to the mapped words
+template <class WordType, endian Endian>
+const typename mapped_bit_span<WordType, Endian>::word_type*
+mapped_bit_span<WordType, Endian>::data(
+) const noexcept
+{
+    return _data;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- MAPPED BIT SPAN: ITERATORS ----------------------- //
+// Returns an iterator to the first bit if writable
+template <class WordType, endian Endian>
+typename mapped_bit_span<WordType, Endian>::iterator
+mapped_bit_span<WordType, Endian>::begin(
+)
+{
+    _check_writability();
+    return iterator(_data);
+}
+
+// Returns a constant iterator to the first bit
+template <class WordType, endian Endian>
+typename mapped_bit_span<WordType, Endian>::const_iterator
+mapped_bit_span<WordType, Endian>::begin(
+) const noexcept
+{
+    return const_iterator(_data);
+}
+
+// Returns a constant iterator to the first bit
+template <class WordType, endian Endian>
+typename mapped_bit_span<WordType, Endian>::const_iterator
+mapped_bit_span<WordType, Endian>::cbegin(
+) const noexcept
+{
+    return const_iterator(_data);
+}
+
+// Returns an iterator past the last bit if writable
+template <class WordType, endian Endian>
+typename mapped_bit_span<WordType, Endian>::iterator
+mapped_bit_span<WordType, Endian>::end(
+)
+{
+    _check_writability();
+    return iterator(_data + _size / _digits, _size % _digits);
+}
+
+// Returns a constant iterator past the last bit
+template <class WordType, endian Endian>
+typename mapped_bit_span<WordType, Endian>::const_iterator
+mapped_bit_span<WordType, Endian>::end(
+) const noexcept
+{
+    return const_iterator(_data + _size / _digits, _size % _digits);
+}
+
+// Returns a constant iterator past the last bit
+template <class WordType, endian Endian>
+typename mapped_bit_span<WordType, Endian>::const_iterator
+mapped_bit_span<WordType, Endian>::cend(
+) const noexcept
+{
+    return const_iterator(_data + _size / _digits, _size % _digits);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- MAPPED BIT SPAN: CAPACITY ------------------------ //
+// Checks whether the span is empty
+template <class WordType, endian Endian>
+bool mapped_bit_span<WordType, Endian>::empty(
+) const noexcept
+{
+    return _size == 0;
+}
+
+// Returns the number of bits, the trailing bytes of the file being ignored
+template <class WordType, endian Endian>
+typename mapped_bit_span<WordType, Endian>::size_type
+mapped_bit_span<WordType, Endian>::size(
+) const noexcept
+{
+    return _size;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ MAPPED BIT SPAN: MAPPING ------------------------ //
+// Checks whether a file is mapped
+template <class WordType, endian Endian>
+bool mapped_bit_span<WordType, Endian>::is_open(
+) const noexcept
+{
+    return _data != nullptr;
+}
+
+// Returns the access mode of the mapping
+template <class WordType, endian Endian>
+mapped_mode mapped_bit_span<WordType, Endian>::mode(
+) const noexcept
+{
+    return _mode;
+}
+
+// Passes an access pattern hint to the system and returns whether it is used
+template <class WordType, endian Endian>
+bool mapped_bit_span<WordType, Endian>::advise(
+    mapped_advice advice
+) noexcept
+{
+    int flag = -1;
+    switch (advice) {
+        case mapped_advice::normal: flag = MADV_NORMAL; break;
+        case mapped_advice::sequential: flag = MADV_SEQUENTIAL; break;
+        case mapped_advice::random: flag = MADV_RANDOM; break;
+        case mapped_advice::will_need: flag = MADV_WILLNEED; break;
+        case mapped_advice::dont_need: flag = MADV_DONTNEED; break;
+#if defined(MADV_HUGEPAGE)
+        case mapped_advice::huge_pages: flag = MADV_HUGEPAGE; break;
+#endif
+        default: break;
+    }
+    return _data && flag >= 0 && ::madvise(_data, _bytes, flag) == 0;
+}
+
+// Writes the modified pages back to the file
+template <class WordType, endian Endian>
+void mapped_bit_span<WordType, Endian>::sync(
+)
+{
+    if (_data && !_is_foreign && ::msync(_data, _bytes, MS_SYNC) != 0) {
+        throw std::system_error(
+            errno, std::generic_category(), "mapped_bit_span::sync"
+        );
+    }
+}
+
+// Unmaps the file
+template <class WordType, endian Endian>
+void mapped_bit_span<WordType, Endian>::close(
+) noexcept
+{
+    if (_data) {
+        ::munmap(_data, _bytes);
+    }
+    _data = nullptr;
+    _bytes = 0;
+    _size = 0;
+}
+
+// Swaps the mapping with another span
+template <class WordType, endian Endian>
+void mapped_bit_span<WordType, Endian>::swap(
+    mapped_bit_span& other
+) noexcept
+{
+    std::swap(_data, other._data);
+    std::swap(_bytes, other._bytes);
+    std::swap(_size, other._size);
+    std::swap(_mode, other._mode);
+}
+
+// Swaps the mappings of two spans
+template <class WordType, endian Endian>
+void swap(
+    mapped_bit_span<WordType, Endian>& lhs,
+    mapped_bit_span<WordType, Endian>& rhs
+) noexcept
+{
+    lhs.swap(rhs);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------- MAPPED BIT SPAN: IMPLEMENTATION DETAILS: FUNCTION MEMBERS -------- //
+// Opens and maps a file, resizing it to the provided number of bytes if any
+template <class WordType, endian Endian>
+void mapped_bit_span<WordType, Endian>::_map(
+    const std::string& path,
+    int flags,
+    size_type bytes
+)
+{
+    // Initialization
+    const bool is_writable = _mode == mapped_mode::read_write;
+    const int prot = is_writable || _is_foreign
+                   ? PROT_READ | PROT_WRITE
+                   : PROT_READ;
+    const int share = _is_foreign ? MAP_PRIVATE : MAP_SHARED;
+    struct stat status = {};
+    void* ptr = nullptr;
+    int error = 0;
+    int fd = -1;
+
+    // Foreign byte orders cannot be swapped in place in the file
+    if (_is_foreign && is_writable) {
+        throw std::invalid_argument(
+            "mapped_bit_span: foreign byte orders are read only"
+        );
+    }
+
+    // Open, resize and map the file
+    fd = ::open(path.c_str(), flags, 0644);
+    if (fd < 0) {
+        throw std::system_error(
+            errno, std::generic_category(), "mapped_bit_span: " + path
+        );
+    }
+    if (bytes != 0 && ::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+        error = errno;
+    } else if (::fstat(fd, &status) != 0) {
+        error = errno;
+    } else if (status.st_size > 0) {
+        ptr = ::mmap(nullptr, status.st_size, prot, share, fd, 0);
+        error = ptr == MAP_FAILED ? errno : 0;
+    }
+    ::close(fd);
+    if (error != 0) {
+        throw std::system_error(
+            error, std::generic_category(), "mapped_bit_span: " + path
+        );
+    }
+
+    // Expose the whole words and convert them to the native byte order
+    _data = static_cast<word_type*>(ptr);
+    _bytes = status.st_size;
+    _size = _bytes / sizeof(word_type) * _digits;
+    for (size_type i = 0; _is_foreign && i < _size / _digits; ++i) {
+        _data[i] = _byteswap(_data[i]);
+    }
+}
+
+// Throws a logic error if the mapping cannot be written through the span
+template <class WordType, endian Endian>
+void mapped_bit_span<WordType, Endian>::_check_writability(
+) const
+{
+    if (_data && _mode != mapped_mode::read_write) {
+        throw std::logic_error("mapped_bit_span: read only mapping");
+    }
+}
+// -------------------------------------------------------------------------- //
+#endif
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _BIT_MAPPED_SPAN_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,353 @@
+// ============================ BIT RANK SELECT ============================= //
+// Project:         The C++ Bit Library
+// Name:            bit_rank_select.hpp
+// Description:     A succinct index answering rank and select queries
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2015-2017]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_RANK_SELECT_HPP_INCLUDED
+#define _BIT_RANK_SELECT_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <vector>
+#include <cstdint>
+// Project sources
+#include "bit_details.hpp"
+#include "bit_value.hpp"
+#include "bit_reference.hpp"
+#include "bit_pointer.hpp"
+#include "bit_iterator.hpp"
+#include "bit_algorithm.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* *************************** RANK SELECT INDEX **************************** */
+// Rank select index class definition
+template <class Iterator>
+class rank_select_index
+{
+    // Types
+    public:
+    using iterator = bit_iterator<Iterator>;
+    using word_type = typename iterator::word_type;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    // Lifecycle
+    public:
+    rank_select_index();
+    rank_select_index(iterator first, iterator last);
+
+    // Capacity
+    public:
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+    size_type count() const noexcept;
+    size_type memory() const noexcept;
+
+    // Queries
+    public:
+    size_type rank(size_type pos) const;
+    size_type select(size_type k) const;
+
+    // Implementation details: function members
+    private:
+    size_type _block_rank(size_type block) const noexcept;
+    size_type _count_ones(size_type first, size_type last) const;
+    size_type _subblock_count(size_type block, size_type subblock) const;
+
+    // Implementation details: data members
+    private:
+    static constexpr size_type _superblock_digits = std::uint64_t(1) << 32;
+    static constexpr size_type _block_digits = 2048;
+    static constexpr size_type _subblock_digits = 512;
+    static constexpr size_type _subblock_count_digits = 10;
+    static constexpr size_type _sample_rate = 8192;
+    iterator _first;
+    size_type _size;
+    size_type _count;
+    std::vector<std::uint64_t> _superblocks;
+    std::vector<std::uint64_t> _blocks;
+    std::vector<std::uint64_t> _samples;
+};
+/* ************************************************************************** */
+
+
+
+// ---------------------- RANK SELECT INDEX: LIFECYCLE ---------------------- //
+// Implicitly default constructs an index over an empty range
+template <class Iterator>
+rank_select_index<Iterator>::rank_select_index(
+)
+: _first()
+, _size(0)
+, _count(0)
+, _superblocks(1, 0)
+, _blocks(1, 0)
+, _samples()
+{
+}
+
+// Builds the index over a range that should not be modified afterwards
+template <class Iterator>
+rank_select_index<Iterator>::rank_select_index(
+    iterator first,
+    iterator last
+)
+: _first(first)
+, _size(std::distance(first, last))
+, _count(0)
+, _superblocks()
+, _blocks()
+, _samples()
+{
+    // Types and constants
+    constexpr size_type blocks_per_superblock = _superblock_digits
+                                              / _block_digits;
+    constexpr size_type subblocks = _block_digits / _subblock_digits;
+
+    // Initialization
+    const size_type blocks = _size / _block_digits + 1;
+    std::uint64_t entry = 0;
+    size_type pos = 0;
+    size_type cnt = 0;
+    size_type sum = 0;
+    _blocks.reserve(blocks);
+
+    // Store the relative counts of the first subblocks next to the block rank
+    for (size_type block = 0; block < blocks; ++block) {
+        if (block % blocks_per_superblock == 0) {
+            _superblocks.push_back(_count);
+        }
+        entry = _count - _superblocks.back();
+        sum = 0;
+        for (size_type subblock = 0; subblock < subblocks; ++subblock) {
+            pos = block * _block_digits + subblock * _subblock_digits;
+            pos = std::min(pos, _size);
+            cnt = bit::count(
+                std::next(first, pos),
+                std::next(first, std::min(pos + _subblock_digits, _size)),
+                bit1
+            );
+            if (subblock + 1 < subblocks) {
+                entry |= static_cast<std::uint64_t>(cnt) << (
+                    32 + subblock * _subblock_count_digits
+                );
+            }
+            sum += cnt;
+        }
+        for (; _samples.size() * _sample_rate < _count + sum;) {
+            _samples.push_back(block);
+        }
+        _blocks.push_back(entry);
+        _count += sum;
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- RANK SELECT INDEX: CAPACITY ----------------------- //
+// Checks whether the indexed range is empty
+template <class Iterator>
+bool rank_select_index<Iterator>::empty(
+) const noexcept
+{
+    return _size == 0;
+}
+
+// Returns the number of bits of the indexed range
+template <class Iterator>
+typename rank_select_index<Iterator>::size_type
+rank_select_index<Iterator>::size(
+) const noexcept
+{
+    return _size;
+}
+
+// Returns the number of bits set to one in the indexed range
+template <class Iterator>
+typename rank_select_index<Iterator>::size_type
+rank_select_index<Iterator>::count(
+) const noexcept
+{
+    return _count;
+}
+
+// Returns the number of bytes used by the index
+template <class Iterator>
+typename rank_select_index<Iterator>::size_type
+rank_select_index<Iterator>::memory(
+) const noexcept
+{
+    return (_superblocks.size() + _blocks.size() + _samples.size())
+         * sizeof(std::uint64_t);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- RANK SELECT INDEX: QUERIES ----------------------- //
+// Returns the number of bits set to one before pos
+template <class Iterator>
+typename rank_select_index<Iterator>::size_type
+rank_select_index<Iterator>::rank(
+    size_type pos
+) const
+{
+    // Initialization
+    const size_type block = pos / _block_digits;
+    const size_type subblock = pos % _block_digits / _subblock_digits;
+    const size_type first = block * _block_digits + subblock * _subblock_digits;
+    size_type result = _block_rank(block);
+
+    // Add the subblock counts and count the remaining bits with popcnt
+    for (size_type i = 0; i < subblock; ++i) {
+        result += _subblock_count(block, i);
+    }
+    return result + _count_ones(first, pos);
+}
+
+// Returns the position of the one of rank k, or the size if there is none
+template <class Iterator>
+typename rank_select_index<Iterator>::size_type
+rank_select_index<Iterator>::select(
+    size_type k
+) const
+{
+    // Types and constants
+    using value_type = typename std::remove_cv<word_type>::type;
+    constexpr size_type digits = binary_digits<value_type>::value;
+    constexpr size_type subblocks = _block_digits / _subblock_digits;
+    constexpr value_type one = 1;
+
+    // Initialization
+    const size_type sample = k / _sample_rate;
+    size_type first = 0;
+    size_type last = 0;
+    size_type middle = 0;
+    size_type subblock = 0;
+    size_type cnt = 0;
+    size_type pos = 0;
+    size_type len = 0;
+    iterator it = _first;
+    value_type value = 0;
+
+    // Nothing to select
+    if (k >= _count) {
+        return _size;
+    }
+
+    // Find the block between the surrounding samples with a binary search
+    first = _samples[sample];
+    last = sample + 1 < _samples.size()
+         ? _samples[sample + 1] + 1
+         : _blocks.size();
+    while (last - first > 1) {
+        middle = first + (last - first) / 2;
+        if (_block_rank(middle) <= k) {
+            first = middle;
+        } else {
+            last = middle;
+        }
+    }
+    k -= _block_rank(first);
+
+    // Find the subblock with the relative counts
+    for (; subblock + 1 < subblocks; ++subblock) {
+        cnt = _subblock_count(first, subblock);
+        if (k < cnt) {
+            break;
+        }
+        k -= cnt;
+    }
+
+    // Find the word with popcnt and the bit with pdep and tzcnt
+    pos = first * _block_digits + subblock * _subblock_digits;
+    it = std::next(_first, pos);
+    for (; pos < _size; pos += len) {
+        len = std::min(digits, _size - pos);
+        value = _read_word(it.base(), it.position(), len);
+        value = _bextr<value_type>(value, 0, len);
+        cnt = _popcnt(value);
+        if (k < cnt) {
+            pos += _tzcnt(_pdep<value_type>(one << k, value));
+            break;
+        }
+        k -= cnt;
+        it = std::next(it, len);
+    }
+    return pos;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------ RANK SELECT INDEX: IMPLEMENTATION DETAILS: FUNCTION MEMBERS ------- //
+// Returns the number of bits set to one before the provided block
+template <class Iterator>
+typename rank_select_index<Iterator>::size_type
+rank_select_index<Iterator>::_block_rank(
+    size_type block
+) const noexcept
+{
+    constexpr size_type blocks_per_superblock = _superblock_digits
+                                              / _block_digits;
+    constexpr std::uint64_t msk = 0xFFFFFFFF;
+    return _superblocks[block / blocks_per_superblock] + (_blocks[block] & msk);
+}
+
+// Counts the bits set to one between two positions of the same subblock
+template <class Iterator>
+typename rank_select_index<Iterator>::size_type
+rank_select_index<Iterator>::_count_ones(
+    size_type first,
+    size_type last
+) const
+{
+    using value_type = typename std::remove_cv<word_type>::type;
+    constexpr size_type digits = binary_digits<value_type>::value;
+    const iterator it = std::next(_first, first);
+    auto base = it.base();
+    size_type pos = it.position();
+    size_type len = 0;
+    size_type result = 0;
+    for (; first < last; first += len) {
+        len = std::min(digits, last - first);
+        result += _popcnt(_bextr<value_type>(
+            _read_word(base, pos, len), 0, len
+        ));
+        ++base;
+    }
+    return result;
+}
+
+// Returns the number of bits set to one in a subblock of a block
+template <class Iterator>
+typename rank_select_index<Iterator>::size_type
+rank_select_index<Iterator>::_subblock_count(
+    size_type block,
+    size_type subblock
+) const
+{
+    constexpr std::uint64_t msk = (1 << _subblock_count_digits) - 1;
+    const size_type shift = 32 + subblock * _subblock_count_digits;
+    return (_blocks[block] >> shift) & msk;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _BIT_RANK_SELECT_HPP_INCLUDED
+// ========================================================================== //
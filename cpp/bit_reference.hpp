@@ -267,7 +267,7 @@ template <class WordType>
 constexpr bit_reference<WordType>::operator bool(
 ) const noexcept
 {
-    return *_ptr & _mask;
+    return static_cast<bool>(*_ptr & _mask);
 }
 // -------------------------------------------------------------------------- //
 
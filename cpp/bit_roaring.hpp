@@ -0,0 +1,816 @@
+// ============================== BIT ROARING =============================== //
+// Project:         The C++ Bit Library
+// Name:            bit_roaring.hpp
+// Description:     A compressed bitmap with array, bitmap and run containers
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2015-2017]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_ROARING_HPP_INCLUDED
+#define _BIT_ROARING_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <stdexcept>
+#include <functional>
+#include <initializer_list>
+// Project sources
+#include "bit_details.hpp"
+#include "bit_value.hpp"
+#include "bit_reference.hpp"
+#include "bit_pointer.hpp"
+#include "bit_iterator.hpp"
+#include "bit_algorithm.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* ***************************** ROARING BITMAP ***************************** */
+// Roaring container kinds
+enum class roaring_container: unsigned char {
+    array,
+    bitmap,
+    run
+};
+
+// Roaring bitmap class definition: runs are only created by optimize, while
+// insert and erase turn a run container into a bitmap container and bitwise
+// operators never produce runs, so optimize should be called again afterwards
+class roaring_bitmap
+{
+    // Types
+    public:
+    using value_type = std::uint32_t;
+    using word_type = std::uint64_t;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_iterator = bit_iterator<const word_type*>;
+
+    // Lifecycle
+    public:
+    roaring_bitmap();
+    template <class Iterator>
+    roaring_bitmap(bit_iterator<Iterator> first, bit_iterator<Iterator> last);
+    roaring_bitmap(std::initializer_list<value_type> init);
+
+    // Element access
+    public:
+    bool contains(value_type value) const;
+    template <class UnaryFunction>
+    UnaryFunction for_each(UnaryFunction f) const;
+
+    // Containers
+    public:
+    size_type containers() const noexcept;
+    roaring_container kind(size_type pos) const;
+    value_type offset(size_type pos) const;
+    const_iterator dense_begin(size_type pos) const;
+    const_iterator dense_end(size_type pos) const;
+
+    // Capacity
+    public:
+    bool empty() const noexcept;
+    size_type count() const noexcept;
+    size_type memory() const noexcept;
+
+    // Modifiers
+    public:
+    void clear() noexcept;
+    bool insert(value_type value);
+    bool erase(value_type value);
+    void optimize();
+    void swap(roaring_bitmap& other) noexcept;
+
+    // Bitwise operators
+    public:
+    roaring_bitmap& operator&=(const roaring_bitmap& other);
+    roaring_bitmap& operator|=(const roaring_bitmap& other);
+    roaring_bitmap& operator^=(const roaring_bitmap& other);
+
+    // Implementation details: types
+    private:
+    struct _container {
+        roaring_container kind;
+        std::uint16_t key;
+        size_type cardinality;
+        std::vector<std::uint16_t> values;
+        std::vector<word_type> words;
+    };
+
+    // Implementation details: function members
+    private:
+    size_type _find(std::uint16_t key) const;
+    static bool _contains(const _container& c, std::uint16_t low);
+    static void _to_bitmap(_container& c);
+    static void _normalize(_container& c, bool runs);
+    template <class Operation>
+    static _container _combine(
+        const _container& lhs,
+        const _container& rhs,
+        Operation op
+    );
+    template <class Operation>
+    static roaring_bitmap _combine(
+        const roaring_bitmap& lhs,
+        const roaring_bitmap& rhs,
+        Operation op
+    );
+
+    // Implementation details: data members
+    private:
+    static constexpr size_type _container_digits = 65536;
+    static constexpr size_type _container_words = 1024;
+    static constexpr size_type _array_capacity = 4096;
+    static constexpr size_type _low_digits = 16;
+    std::vector<_container> _containers;
+};
+
+// Bitwise operators
+roaring_bitmap operator&(const roaring_bitmap& lhs, const roaring_bitmap& rhs);
+roaring_bitmap operator|(const roaring_bitmap& lhs, const roaring_bitmap& rhs);
+roaring_bitmap operator^(const roaring_bitmap& lhs, const roaring_bitmap& rhs);
+
+// Swap
+void swap(roaring_bitmap& lhs, roaring_bitmap& rhs) noexcept;
+/* ************************************************************************** */
+
+
+
+// ----------------------- ROARING BITMAP: LIFECYCLE ------------------------ //
+// Implicitly default constructs an empty roaring bitmap
+inline roaring_bitmap::roaring_bitmap(
+)
+: _containers()
+{
+}
+
+// Compresses a range of bits of words of at most 64 bits, the values being
+// the positions of the ones, and throws a length error if the range exceeds
+// the range of the values
+template <class Iterator>
+roaring_bitmap::roaring_bitmap(
+    bit_iterator<Iterator> first,
+    bit_iterator<Iterator> last
+)
+: _containers()
+{
+    // Types and constants
+    constexpr size_type container_digits = _container_digits;
+    constexpr size_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    const size_type n = std::distance(first, last);
+    bit_iterator<Iterator> it = first;
+    bit_iterator<Iterator> next = first;
+    Iterator base = first.base();
+    size_type len = 0;
+    _container c = {roaring_container::bitmap, 0, 0, {}, {}};
+
+    // Rejects the ranges whose positions would not fit in the keys
+    if (n != 0 && n - 1 > std::numeric_limits<value_type>::max()) {
+        throw std::length_error("bit::roaring_bitmap");
+    }
+
+    // Copy each chunk of 65536 bits with ones to a container and compress it
+    for (size_type pos = 0; pos < n; pos += len) {
+        len = std::min(n - pos, container_digits);
+        next = std::next(it, len);
+        if (bit::find(it, next, bit1) != next) {
+            c.kind = roaring_container::bitmap;
+            c.key = static_cast<std::uint16_t>(pos >> _low_digits);
+            c.words.assign(_container_words, 0);
+            base = it.base();
+            for (size_type i = 0; i * digits < len; ++i) {
+                c.words[i] = _read_chunk<word_type>(
+                    base, it.position(), std::min(digits, len - i * digits)
+                );
+            }
+            _normalize(c, true);
+            _containers.push_back(std::move(c));
+        }
+        it = next;
+    }
+}
+
+// Constructs a roaring bitmap from a list of values
+inline roaring_bitmap::roaring_bitmap(
+    std::initializer_list<value_type> init
+)
+: _containers()
+{
+    for (value_type value: init) {
+        insert(value);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- ROARING BITMAP: ELEMENT ACCESS --------------------- //
+// Checks whether the value belongs to the bitmap
+inline bool roaring_bitmap::contains(
+    value_type value
+) const
+{
+    const std::uint16_t key = static_cast<std::uint16_t>(value >> _low_digits);
+    const size_type pos = _find(key);
+    return pos < _containers.size()
+        && _containers[pos].key == key
+        && _contains(_containers[pos], static_cast<std::uint16_t>(value));
+}
+
+// Applies a function to each value of the bitmap, in increasing order
+template <class UnaryFunction>
+UnaryFunction roaring_bitmap::for_each(
+    UnaryFunction f
+) const
+{
+    // Types and constants
+    constexpr size_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    value_type base = 0;
+    word_type value = 0;
+
+    // Go through the containers depending on their kind
+    for (const _container& c: _containers) {
+        base = static_cast<value_type>(c.key) << _low_digits;
+        if (c.kind == roaring_container::array) {
+            for (std::uint16_t low: c.values) {
+                f(base + low);
+            }
+        } else if (c.kind == roaring_container::run) {
+            for (size_type i = 0; i < c.values.size(); i += 2) {
+                for (value_type j = 0; j <= c.values[i + 1]; ++j) {
+                    f(base + c.values[i] + j);
+                }
+            }
+        } else {
+            for (size_type i = 0; i < _container_words; ++i) {
+                for (value = c.words[i]; value; value &= value - 1) {
+                    f(base + static_cast<value_type>(i * digits)
+                           + static_cast<value_type>(_tzcnt(value)));
+                }
+            }
+        }
+    }
+    return f;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- ROARING BITMAP: CONTAINERS ----------------------- //
+// Returns the number of containers
+inline roaring_bitmap::size_type roaring_bitmap::containers(
+) const noexcept
+{
+    return _containers.size();
+}
+
+// Returns the kind of a container
+inline roaring_container roaring_bitmap::kind(
+    size_type pos
+) const
+{
+    return _containers[pos].kind;
+}
+
+// Returns the first value covered by a container
+inline roaring_bitmap::value_type roaring_bitmap::offset(
+    size_type pos
+) const
+{
+    return static_cast<value_type>(_containers[pos].key) << _low_digits;
+}
+
+// Returns an iterator to the first bit of a bitmap container
+inline roaring_bitmap::const_iterator roaring_bitmap::dense_begin(
+    size_type pos
+) const
+{
+    assert(_containers[pos].kind == roaring_container::bitmap);
+    return const_iterator(_containers[pos].words.data());
+}
+
+// Returns an iterator past the last bit of a bitmap container
+inline roaring_bitmap::const_iterator roaring_bitmap::dense_end(
+    size_type pos
+) const
+{
+    assert(_containers[pos].kind == roaring_container::bitmap);
+    return const_iterator(_containers[pos].words.data() + _container_words);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ ROARING BITMAP: CAPACITY ------------------------ //
+// Checks whether the bitmap is empty
+inline bool roaring_bitmap::empty(
+) const noexcept
+{
+    return _containers.empty();
+}
+
+// Returns the number of values in the bitmap
+inline roaring_bitmap::size_type roaring_bitmap::count(
+) const noexcept
+{
+    size_type result = 0;
+    for (const _container& c: _containers) {
+        result += c.cardinality;
+    }
+    return result;
+}
+
+// Returns the number of bytes used by the containers
+inline roaring_bitmap::size_type roaring_bitmap::memory(
+) const noexcept
+{
+    size_type result = _containers.size() * sizeof(_container);
+    for (const _container& c: _containers) {
+        result += c.values.size() * sizeof(std::uint16_t);
+        result += c.words.size() * sizeof(word_type);
+    }
+    return result;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- ROARING BITMAP: MODIFIERS ------------------------ //
+// Removes all the values
+inline void roaring_bitmap::clear(
+) noexcept
+{
+    _containers.clear();
+}
+
+// Inserts a value and returns whether it was not already in the bitmap, a
+// run container being converted to a bitmap container
+inline bool roaring_bitmap::insert(
+    value_type value
+)
+{
+    // Types and constants
+    constexpr size_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    const std::uint16_t key = static_cast<std::uint16_t>(value >> _low_digits);
+    const std::uint16_t low = static_cast<std::uint16_t>(value);
+    const size_type pos = _find(key);
+    const word_type msk = static_cast<word_type>(1) << (low % digits);
+    std::vector<std::uint16_t>::iterator it;
+    bool inserted = false;
+
+    // Create a new array container if needed
+    if (pos == _containers.size() || _containers[pos].key != key) {
+        _containers.insert(
+            _containers.begin() + pos,
+            _container{roaring_container::array, key, 0, {}, {}}
+        );
+    }
+    _container& c = _containers[pos];
+
+    // Insert the value depending on the kind of container
+    if (c.kind == roaring_container::run) {
+        _to_bitmap(c);
+    }
+    if (c.kind == roaring_container::array) {
+        it = std::lower_bound(c.values.begin(), c.values.end(), low);
+        inserted = it == c.values.end() || *it != low;
+        if (inserted) {
+            c.values.insert(it, low);
+        }
+    } else {
+        inserted = !(c.words[low / digits] & msk);
+        c.words[low / digits] |= msk;
+    }
+    c.cardinality += inserted;
+    _normalize(c, false);
+    return inserted;
+}
+
+// Erases a value and returns whether it was in the bitmap, a run container
+// being converted to a bitmap container
+inline bool roaring_bitmap::erase(
+    value_type value
+)
+{
+    // Types and constants
+    constexpr size_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    const std::uint16_t key = static_cast<std::uint16_t>(value >> _low_digits);
+    const std::uint16_t low = static_cast<std::uint16_t>(value);
+    const size_type pos = _find(key);
+    const word_type msk = static_cast<word_type>(1) << (low % digits);
+    std::vector<std::uint16_t>::iterator it;
+    bool erased = false;
+
+    // Nothing to erase
+    if (pos == _containers.size() || _containers[pos].key != key) {
+        return false;
+    }
+    _container& c = _containers[pos];
+
+    // Erase the value depending on the kind of container
+    if (c.kind == roaring_container::run) {
+        _to_bitmap(c);
+    }
+    if (c.kind == roaring_container::array) {
+        it = std::lower_bound(c.values.begin(), c.values.end(), low);
+        erased = it != c.values.end() && *it == low;
+        if (erased) {
+            c.values.erase(it);
+        }
+    } else {
+        erased = static_cast<bool>(c.words[low / digits] & msk);
+        c.words[low / digits] &= ~msk;
+    }
+    c.cardinality -= erased;
+    _normalize(c, false);
+    if (c.cardinality == 0) {
+        _containers.erase(_containers.begin() + pos);
+    }
+    return erased;
+}
+
+// Converts each container to its most compact kind, including runs
+inline void roaring_bitmap::optimize(
+)
+{
+    for (_container& c: _containers) {
+        _normalize(c, true);
+    }
+}
+
+// Swaps the contents with another roaring bitmap
+inline void roaring_bitmap::swap(
+    roaring_bitmap& other
+) noexcept
+{
+    _containers.swap(other._containers);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------- ROARING BITMAP: BITWISE OPERATORS -------------------- //
+// Keeps the values that belong to both bitmaps
+inline roaring_bitmap& roaring_bitmap::operator&=(
+    const roaring_bitmap& other
+)
+{
+    return *this = _combine(*this, other, std::bit_and<word_type>());
+}
+
+// Keeps the values that belong to any bitmap
+inline roaring_bitmap& roaring_bitmap::operator|=(
+    const roaring_bitmap& other
+)
+{
+    return *this = _combine(*this, other, std::bit_or<word_type>());
+}
+
+// Keeps the values that belong to exactly one bitmap
+inline roaring_bitmap& roaring_bitmap::operator^=(
+    const roaring_bitmap& other
+)
+{
+    return *this = _combine(*this, other, std::bit_xor<word_type>());
+}
+
+// Returns the values that belong to both bitmaps
+inline roaring_bitmap operator&(
+    const roaring_bitmap& lhs,
+    const roaring_bitmap& rhs
+)
+{
+    roaring_bitmap result(lhs);
+    return result &= rhs;
+}
+
+// Returns the values that belong to any bitmap
+inline roaring_bitmap operator|(
+    const roaring_bitmap& lhs,
+    const roaring_bitmap& rhs
+)
+{
+    roaring_bitmap result(lhs);
+    return result |= rhs;
+}
+
+// Returns the values that belong to exactly one bitmap
+inline roaring_bitmap operator^(
+    const roaring_bitmap& lhs,
+    const roaring_bitmap& rhs
+)
+{
+    roaring_bitmap result(lhs);
+    return result ^= rhs;
+}
+
+// Swaps the contents of two roaring bitmaps
+inline void swap(
+    roaring_bitmap& lhs,
+    roaring_bitmap& rhs
+) noexcept
+{
+    lhs.swap(rhs);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------- ROARING BITMAP: IMPLEMENTATION DETAILS: FUNCTION MEMBERS -------- //
+// Returns the position of the first container whose key is not less than key
+inline roaring_bitmap::size_type roaring_bitmap::_find(
+    std::uint16_t key
+) const
+{
+    return std::lower_bound(
+        _containers.begin(),
+        _containers.end(),
+        key,
+        [](const _container& c, std::uint16_t k){return c.key < k;}
+    ) - _containers.begin();
+}
+
+// Checks whether a container holds the provided low bits
+inline bool roaring_bitmap::_contains(
+    const _container& c,
+    std::uint16_t low
+)
+{
+    constexpr size_type digits = binary_digits<word_type>::value;
+    bool result = false;
+    size_type first = 0;
+    size_type last = c.values.size() / 2;
+    size_type middle = 0;
+    if (c.kind == roaring_container::array) {
+        result = std::binary_search(c.values.begin(), c.values.end(), low);
+    } else if (c.kind == roaring_container::bitmap) {
+        result = (c.words[low / digits] >> (low % digits)) & 1;
+    } else {
+        while (first < last) {
+            middle = first + (last - first) / 2;
+            if (c.values[middle * 2] <= low) {
+                first = middle + 1;
+            } else {
+                last = middle;
+            }
+        }
+        result = first != 0
+              && low - c.values[first * 2 - 2] <= c.values[first * 2 - 1];
+    }
+    return result;
+}
+
+// Converts a container to a bitmap container
+inline void roaring_bitmap::_to_bitmap(
+    _container& c
+)
+{
+    constexpr size_type digits = binary_digits<word_type>::value;
+    std::vector<word_type> words;
+    bit_iterator<word_type*> it;
+    if (c.kind == roaring_container::bitmap) {
+        return;
+    }
+    words.assign(_container_words, 0);
+    it = bit_iterator<word_type*>(words.data());
+    if (c.kind == roaring_container::array) {
+        for (std::uint16_t low: c.values) {
+            words[low / digits] |= static_cast<word_type>(1) << (low % digits);
+        }
+    } else if (c.kind == roaring_container::run) {
+        for (size_type i = 0; i < c.values.size(); i += 2) {
+            bit::fill(
+                std::next(it, c.values[i]),
+                std::next(it, c.values[i] + c.values[i + 1] + 1),
+                bit1
+            );
+        }
+    }
+    c.kind = roaring_container::bitmap;
+    c.values.clear();
+    c.words.swap(words);
+}
+
+// Converts a container to the most compact kind, runs being optional
+inline void roaring_bitmap::_normalize(
+    _container& c,
+    bool runs
+)
+{
+    // Types and constants
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr size_type bitmap_bytes = _container_words * sizeof(word_type);
+
+    // Initialization
+    const bit_iterator<word_type*> first(c.words.data());
+    const bit_iterator<word_type*> last(c.words.data() + c.words.size());
+    bit_iterator<word_type*> it = first;
+    bit_iterator<word_type*> next = first;
+    size_type run_count = 0;
+    word_type carry = 0;
+    word_type value = 0;
+
+    // Small arrays and large bitmaps are already compact without runs
+    if (!runs && c.kind == roaring_container::array) {
+        c.cardinality = c.values.size();
+        if (c.cardinality <= _array_capacity) {
+            return;
+        }
+    } else if (!runs && c.kind == roaring_container::bitmap) {
+        if (c.cardinality > _array_capacity) {
+            return;
+        }
+    }
+
+    // Go through a bitmap to count the values and the runs
+    if (c.kind != roaring_container::bitmap) {
+        _to_bitmap(c);
+        _normalize(c, runs);
+        return;
+    }
+    c.cardinality = bit::count(first, last, bit1);
+    for (size_type i = 0; runs && i < _container_words; ++i) {
+        value = c.words[i];
+        run_count += _popcnt(value & ~((value << 1) | carry));
+        carry = value >> (digits - 1);
+    }
+
+    // Extract the runs with find
+    if (runs && run_count * 4 < std::min(c.cardinality * 2, bitmap_bytes)) {
+        c.kind = roaring_container::run;
+        c.values.clear();
+        c.values.reserve(run_count * 2);
+        for (it = bit::find(first, last, bit1); it != last;) {
+            next = bit::find(it, last, bit0);
+            c.values.push_back(static_cast<std::uint16_t>(it - first));
+            c.values.push_back(static_cast<std::uint16_t>(next - it - 1));
+            it = bit::find(next, last, bit1);
+        }
+        c.words.clear();
+    // Extract the values with tzcnt
+    } else if (c.cardinality <= _array_capacity) {
+        c.kind = roaring_container::array;
+        c.values.clear();
+        c.values.reserve(c.cardinality);
+        for (size_type i = 0; i < _container_words; ++i) {
+            for (value = c.words[i]; value; value &= value - 1) {
+                c.values.push_back(static_cast<std::uint16_t>(
+                    i * digits + _tzcnt(value)
+                ));
+            }
+        }
+        c.words.clear();
+    }
+}
+
+// Combines two containers with the same key through a bitwise operation
+template <class Operation>
+roaring_bitmap::_container roaring_bitmap::_combine(
+    const _container& lhs,
+    const _container& rhs,
+    Operation op
+)
+{
+    // Types and constants
+    constexpr word_type zero = 0;
+    constexpr word_type one = 1;
+    const bool keeps_lhs = op(one, zero) & one;
+    const bool keeps_rhs = op(zero, one) & one;
+
+    // Initialization
+    _container result = {roaring_container::array, lhs.key, 0, {}, {}};
+    _container lhs_bitmap = {roaring_container::array, lhs.key, 0, {}, {}};
+    _container rhs_bitmap = {roaring_container::array, rhs.key, 0, {}, {}};
+    auto it = lhs.values.begin();
+    auto rit = rhs.values.begin();
+    bool in_lhs = false;
+    bool in_rhs = false;
+    std::uint16_t low = 0;
+
+    // Merge two arrays
+    if (lhs.kind == roaring_container::array
+     && rhs.kind == roaring_container::array) {
+        while (it != lhs.values.end() || rit != rhs.values.end()) {
+            in_lhs = it != lhs.values.end()
+                  && (rit == rhs.values.end() || *it <= *rit);
+            in_rhs = rit != rhs.values.end()
+                  && (it == lhs.values.end() || *rit <= *it);
+            low = in_lhs ? *it : *rit;
+            if (op(zero + in_lhs, zero + in_rhs) & one) {
+                result.values.push_back(low);
+            }
+            it += in_lhs;
+            rit += in_rhs;
+        }
+    // Filter the values of an array by the other container
+    } else if (lhs.kind == roaring_container::array && !keeps_rhs) {
+        for (std::uint16_t value: lhs.values) {
+            if (op(one, zero + _contains(rhs, value)) & one) {
+                result.values.push_back(value);
+            }
+        }
+    } else if (rhs.kind == roaring_container::array && !keeps_lhs) {
+        for (std::uint16_t value: rhs.values) {
+            if (op(zero + _contains(lhs, value), one) & one) {
+                result.values.push_back(value);
+            }
+        }
+    // Combine two bitmaps word by word
+    } else {
+        lhs_bitmap = lhs;
+        rhs_bitmap = rhs;
+        _to_bitmap(lhs_bitmap);
+        _to_bitmap(rhs_bitmap);
+        result.kind = roaring_container::bitmap;
+        result.words.resize(_container_words);
+        bit::transform(
+            bit_iterator<const word_type*>(lhs_bitmap.words.data()),
+            bit_iterator<const word_type*>(
+                lhs_bitmap.words.data() + _container_words
+            ),
+            bit_iterator<const word_type*>(rhs_bitmap.words.data()),
+            bit_iterator<word_type*>(result.words.data()),
+            op
+        );
+        result.cardinality = bit::count(
+            bit_iterator<const word_type*>(result.words.data()),
+            bit_iterator<const word_type*>(
+                result.words.data() + _container_words
+            ),
+            bit1
+        );
+    }
+    _normalize(result, false);
+    return result;
+}
+
+// Combines two roaring bitmaps container by container
+template <class Operation>
+roaring_bitmap roaring_bitmap::_combine(
+    const roaring_bitmap& lhs,
+    const roaring_bitmap& rhs,
+    Operation op
+)
+{
+    // Types and constants
+    constexpr word_type zero = 0;
+    constexpr word_type one = 1;
+    const bool keeps_lhs = op(one, zero) & one;
+    const bool keeps_rhs = op(zero, one) & one;
+
+    // Initialization
+    roaring_bitmap result;
+    auto it = lhs._containers.begin();
+    auto rit = rhs._containers.begin();
+    const auto last = lhs._containers.end();
+    const auto rlast = rhs._containers.end();
+    _container c = {roaring_container::array, 0, 0, {}, {}};
+
+    // Merge the containers by key
+    while (it != last || rit != rlast) {
+        if (rit == rlast || (it != last && it->key < rit->key)) {
+            if (keeps_lhs) {
+                result._containers.push_back(*it);
+            }
+            ++it;
+        } else if (it == last || rit->key < it->key) {
+            if (keeps_rhs) {
+                result._containers.push_back(*rit);
+            }
+            ++rit;
+        } else {
+            c = _combine(*it, *rit, op);
+            if (c.cardinality != 0) {
+                result._containers.push_back(std::move(c));
+            }
+            ++it;
+            ++rit;
+        }
+    }
+    return result;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _BIT_ROARING_HPP_INCLUDED
+// ========================================================================== //
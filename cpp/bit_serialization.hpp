@@ -0,0 +1,406 @@
+// =========================== BIT SERIALIZATION ============================ //
+// Project:         The C++ Bit Library
+// Name:            bit_serialization.hpp
+// Description:     A framed binary format to store and transmit bit ranges
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2015-2017]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_SERIALIZATION_HPP_INCLUDED
+#define _BIT_SERIALIZATION_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cstring>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+// Project sources
+#include "bit_details.hpp"
+#include "bit_value.hpp"
+#include "bit_reference.hpp"
+#include "bit_pointer.hpp"
+#include "bit_iterator.hpp"
+#include "bit_algorithm.hpp"
+#include "bit_vector.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* ***************************** SERIALIZATION ****************************** */
+// Serialization header: the payload words follow at a cache line boundary
+struct serialization_header {
+    std::uint64_t size;
+    std::size_t word_size;
+    endian order;
+};
+
+// Serialization constants
+constexpr std::size_t serialization_header_size = 64;
+
+// Header
+inline serialization_header parse_serialization_header(
+    const void* data,
+    std::size_t bytes
+);
+
+// Streams
+template <class InputIt>
+std::ostream& serialize(
+    std::ostream& os,
+    bit_iterator<InputIt> first,
+    bit_iterator<InputIt> last,
+    endian order = endian::native
+);
+template <class OutputIt>
+bit_iterator<OutputIt> deserialize(
+    std::istream& is,
+    bit_iterator<OutputIt> d_first,
+    bit_iterator<OutputIt> d_last
+);
+template <class WordType, class Allocator>
+std::istream& deserialize(
+    std::istream& is,
+    bit_vector<WordType, Allocator>& v
+);
+/* ************************************************************************** */
+
+
+
+/* ***************** IMPLEMENTATION DETAILS: SERIALIZATION ****************** */
+// Header
+inline void _encode_header(
+    const serialization_header& header,
+    unsigned char* dst
+) noexcept;
+inline serialization_header _decode_header(const unsigned char* src);
+inline serialization_header _read_header(std::istream& is);
+
+// Payload
+inline void _byteswap_words(
+    unsigned char* data,
+    std::size_t bytes,
+    std::size_t word_size
+) noexcept;
+template <class OutputIt>
+bit_iterator<OutputIt> _read_payload(
+    std::istream& is,
+    const serialization_header& header,
+    bit_iterator<OutputIt> d_first
+);
+/* ************************************************************************** */
+
+
+
+// ------------------------- SERIALIZATION: HEADER -------------------------- //
+// Parses the header of a serialized range in memory, such as a mapped file
+inline serialization_header parse_serialization_header(
+    const void* data,
+    std::size_t bytes
+)
+{
+    if (bytes < serialization_header_size) {
+        throw std::invalid_argument("bit::parse_serialization_header");
+    }
+    return _decode_header(static_cast<const unsigned char*>(data));
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- SERIALIZATION: STREAMS ------------------------- //
+// Writes the header and the words of a range in the provided byte order
+template <class InputIt>
+std::ostream& serialize(
+    std::ostream& os,
+    bit_iterator<InputIt> first,
+    bit_iterator<InputIt> last,
+    endian order
+)
+{
+    // Assertions
+    _assert_range_viability(first, last);
+
+    // Types and constants
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<InputIt>::word_type
+    >::type;
+    using size_type = typename bit_iterator<InputIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr size_type buffer_words = 4096 / sizeof(word_type);
+    constexpr size_type buffer_digits = buffer_words * digits;
+    static_assert(sizeof(word_type) == 1 || sizeof(word_type) == 2
+               || sizeof(word_type) == 4 || sizeof(word_type) == 8, "");
+
+    // Initialization
+    const bool is_native = order == endian::native || sizeof(word_type) == 1;
+    const size_type n = std::distance(first, last);
+    const serialization_header header = {n, sizeof(word_type), order};
+    unsigned char header_bytes[serialization_header_size] = {};
+    word_type buffer[buffer_words];
+    bit_iterator<InputIt> it = first;
+    size_type len = 0;
+    size_type words = 0;
+
+    // Write the header
+    _encode_header(header, header_bytes);
+    os.write(reinterpret_cast<const char*>(header_bytes), sizeof(header_bytes));
+
+    // Write the aligned whole words in bulk when no conversion is needed
+    if (_is_contiguous_iterator<InputIt>::value && is_native) {
+        if (first.position() == 0 && n >= digits) {
+            words = n / digits;
+            os.write(
+                reinterpret_cast<const char*>(&*first.base()),
+                words * sizeof(word_type)
+            );
+            it = std::next(it, words * digits);
+        }
+    }
+
+    // Realign the remaining bits and swap their bytes if needed
+    for (size_type pos = it - first; pos < n; pos += len) {
+        len = std::min(n - pos, buffer_digits);
+        words = (len + digits - 1) / digits;
+        buffer[words - 1] = 0;
+        bit::copy(it, std::next(it, len), bit_iterator<word_type*>(buffer));
+        for (size_type i = 0; !is_native && i < words; ++i) {
+            buffer[i] = _byteswap(buffer[i]);
+        }
+        os.write(
+            reinterpret_cast<const char*>(buffer),
+            words * sizeof(word_type)
+        );
+        it = std::next(it, len);
+    }
+    return os;
+}
+
+// Reads a serialized range into a destination range large enough to hold it
+template <class OutputIt>
+bit_iterator<OutputIt> deserialize(
+    std::istream& is,
+    bit_iterator<OutputIt> d_first,
+    bit_iterator<OutputIt> d_last
+)
+{
+    _assert_range_viability(d_first, d_last);
+    const std::uint64_t n = std::distance(d_first, d_last);
+    const serialization_header header = _read_header(is);
+    if (header.size > n) {
+        throw std::length_error("bit::deserialize");
+    }
+    return _read_payload(is, header, d_first);
+}
+
+// Reads a serialized range into a bit vector grown chunk by chunk as the
+// payload is read, so that a corrupted size cannot exhaust the memory
+template <class WordType, class Allocator>
+std::istream& deserialize(
+    std::istream& is,
+    bit_vector<WordType, Allocator>& v
+)
+{
+    // Types and constants
+    using size_type = typename bit_vector<WordType, Allocator>::size_type;
+    constexpr std::uint64_t chunk_digits = std::uint64_t(1) << 26;
+
+    // Initialization
+    serialization_header header = _read_header(is);
+    const std::uint64_t n = header.size;
+    std::uint64_t len = 0;
+
+    // Read the payload in chunks of whole words of any size
+    if (n > v.max_size()) {
+        throw std::length_error("bit::deserialize");
+    }
+    v.clear();
+    for (std::uint64_t pos = 0; pos < n; pos += len) {
+        len = std::min(n - pos, chunk_digits);
+        header.size = len;
+        v.resize(static_cast<size_type>(pos + len));
+        _read_payload(is, header, v.begin() + static_cast<size_type>(pos));
+    }
+    return is;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------- IMPLEMENTATION DETAILS: SERIALIZATION: HEADER -------------- //
+// Encodes the magic number, the version, the byte order and the sizes
+inline void _encode_header(
+    const serialization_header& header,
+    unsigned char* dst
+) noexcept
+{
+    constexpr std::size_t digits = binary_digits<unsigned char>::value;
+    constexpr std::size_t bytes = sizeof(std::uint64_t);
+    const bool is_big = header.order == endian::big;
+    std::memset(dst, 0, serialization_header_size);
+    std::memcpy(dst, "BITS", 4);
+    dst[4] = 1;
+    dst[5] = is_big;
+    dst[6] = static_cast<unsigned char>(header.word_size);
+    for (std::size_t i = 0; i < bytes; ++i) {
+        dst[8 + (is_big ? bytes - 1 - i : i)] = static_cast<unsigned char>(
+            header.size >> (i * digits)
+        );
+    }
+}
+
+// Decodes and checks a header
+inline serialization_header _decode_header(
+    const unsigned char* src
+)
+{
+    constexpr std::size_t digits = binary_digits<unsigned char>::value;
+    constexpr std::size_t bytes = sizeof(std::uint64_t);
+    const bool is_big = src[5] == 1;
+    const std::size_t word_size = src[6];
+    serialization_header header = {0, word_size, is_big ? endian::big
+                                                        : endian::little};
+    const bool is_valid_size = word_size == 1 || word_size == 2
+                            || word_size == 4 || word_size == 8;
+    if (std::memcmp(src, "BITS", 4) != 0 || src[4] != 1 || src[5] > 1
+     || !is_valid_size) {
+        throw std::invalid_argument("bit::deserialize: invalid header");
+    }
+    for (std::size_t i = 0; i < bytes; ++i) {
+        header.size |= static_cast<std::uint64_t>(
+            src[8 + (is_big ? bytes - 1 - i : i)]
+        ) << (i * digits);
+    }
+    return header;
+}
+
+// Reads and decodes a header from a stream
+inline serialization_header _read_header(
+    std::istream& is
+)
+{
+    unsigned char header_bytes[serialization_header_size] = {};
+    is.read(reinterpret_cast<char*>(header_bytes), sizeof(header_bytes));
+    if (!is) {
+        throw std::runtime_error("bit::deserialize: truncated header");
+    }
+    return _decode_header(header_bytes);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------- IMPLEMENTATION DETAILS: SERIALIZATION: PAYLOAD ------------- //
+// Reverses the bytes of each word of the provided size in a buffer
+inline void _byteswap_words(
+    unsigned char* data,
+    std::size_t bytes,
+    std::size_t word_size
+) noexcept
+{
+    std::uint16_t word16 = 0;
+    std::uint32_t word32 = 0;
+    std::uint64_t word64 = 0;
+    for (std::size_t i = 0; i + word_size <= bytes; i += word_size) {
+        if (word_size == sizeof(word16)) {
+            std::memcpy(&word16, data + i, word_size);
+            word16 = _byteswap(word16);
+            std::memcpy(data + i, &word16, word_size);
+        } else if (word_size == sizeof(word32)) {
+            std::memcpy(&word32, data + i, word_size);
+            word32 = _byteswap(word32);
+            std::memcpy(data + i, &word32, word_size);
+        } else if (word_size == sizeof(word64)) {
+            std::memcpy(&word64, data + i, word_size);
+            word64 = _byteswap(word64);
+            std::memcpy(data + i, &word64, word_size);
+        }
+    }
+}
+
+// Reads the words following a header, converting their size and byte order
+template <class OutputIt>
+bit_iterator<OutputIt> _read_payload(
+    std::istream& is,
+    const serialization_header& header,
+    bit_iterator<OutputIt> d_first
+)
+{
+    // Types and constants
+    using word_type = typename std::remove_cv<
+        typename bit_iterator<OutputIt>::word_type
+    >::type;
+    using size_type = typename bit_iterator<OutputIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr size_type byte_digits = binary_digits<unsigned char>::value;
+    constexpr size_type buffer_bytes = 4096;
+    constexpr size_type buffer_digits = buffer_bytes * byte_digits;
+    constexpr bool is_little = endian::native == endian::little;
+    static_assert(sizeof(word_type) == 1 || sizeof(word_type) == 2
+               || sizeof(word_type) == 4 || sizeof(word_type) == 8, "");
+
+    // Initialization
+    const size_type file_digits = header.word_size * byte_digits;
+    const size_type n = header.size;
+    const bool is_same = header.order == endian::native
+                      && header.word_size == sizeof(word_type);
+    const bool is_file_little = header.order == endian::little;
+    size_type bytes = (n + file_digits - 1) / file_digits * header.word_size;
+    word_type buffer[buffer_bytes / sizeof(word_type)];
+    unsigned char* data = reinterpret_cast<unsigned char*>(buffer);
+    bit_iterator<OutputIt> d_it = d_first;
+    size_type len = 0;
+    size_type words = 0;
+
+    // Read the aligned whole words in bulk when no conversion is needed
+    if (_is_contiguous_iterator<OutputIt>::value && is_same) {
+        if (d_first.position() == 0 && n >= digits) {
+            words = n / digits;
+            is.read(
+                reinterpret_cast<char*>(&*d_first.base()),
+                words * sizeof(word_type)
+            );
+            d_it = std::next(d_it, words * digits);
+            bytes -= words * sizeof(word_type);
+        }
+    }
+
+    // Read the remaining words, going through little endian bytes if needed
+    for (size_type pos = d_it - d_first; is && pos < n; pos += len) {
+        len = std::min(n - pos, buffer_digits);
+        words = std::min(bytes, buffer_bytes);
+        std::memset(data, 0, buffer_bytes);
+        is.read(reinterpret_cast<char*>(data), words);
+        if (!is_same && !is_file_little) {
+            _byteswap_words(data, words, header.word_size);
+        }
+        if (!is_same && !is_little) {
+            _byteswap_words(data, buffer_bytes, sizeof(word_type));
+        }
+        d_it = bit::copy(
+            bit_iterator<word_type*>(buffer),
+            bit_iterator<word_type*>(buffer) + len,
+            d_it
+        );
+        bytes -= words;
+    }
+    if (!is) {
+        throw std::runtime_error("bit::deserialize: truncated payload");
+    }
+    return d_it;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _BIT_SERIALIZATION_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,420 @@
+// =============================== BIT STREAM =============================== //
+// Project:         The C++ Bit Library
+// Name:            bit_stream.hpp
+// Description:     Readers and writers of variable-length fields of bits
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2015-2017]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_STREAM_HPP_INCLUDED
+#define _BIT_STREAM_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cstdint>
+#include <stdexcept>
+// Project sources
+#include "bit_details.hpp"
+#include "bit_value.hpp"
+#include "bit_reference.hpp"
+#include "bit_pointer.hpp"
+#include "bit_iterator.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* ******************************* BIT READER ******************************* */
+// Bit reader class definition
+template <class Iterator>
+class bit_reader
+{
+    // Types
+    public:
+    using iterator = bit_iterator<Iterator>;
+    using word_type = typename iterator::word_type;
+    using size_type = std::size_t;
+    using window_type = std::uint64_t;
+
+    // Assertions
+    static_assert(
+        binary_digits<word_type>::value <= binary_digits<window_type>::value,
+        ""
+    );
+
+    // Lifecycle
+    public:
+    bit_reader(iterator first, iterator last);
+
+    // Capacity
+    public:
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+
+    // Input
+    public:
+    window_type peek(size_type n);
+    window_type read(size_type n);
+    size_type read_unary();
+    void skip(size_type n);
+
+    // Implementation details: function members
+    private:
+    void _refill();
+    void _consume(size_type n) noexcept;
+
+    // Implementation details: data members
+    private:
+    iterator _it;
+    size_type _remaining;
+    window_type _window;
+    size_type _buffered;
+};
+/* ************************************************************************** */
+
+
+
+/* ******************************* BIT WRITER ******************************* */
+// Bit writer class definition
+template <class Iterator>
+class bit_writer
+{
+    // Types
+    public:
+    using iterator = bit_iterator<Iterator>;
+    using word_type = typename iterator::word_type;
+    using size_type = std::size_t;
+    using window_type = std::uint64_t;
+
+    // Assertions
+    static_assert(
+        binary_digits<word_type>::value <= binary_digits<window_type>::value,
+        ""
+    );
+
+    // Lifecycle
+    public:
+    bit_writer(iterator first, iterator last);
+    bit_writer(const bit_writer& other) = delete;
+    bit_writer& operator=(const bit_writer& other) = delete;
+    ~bit_writer();
+
+    // Capacity
+    public:
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+
+    // Output
+    public:
+    void write(window_type value, size_type n);
+    void write_unary(size_type n);
+    iterator flush();
+
+    // Implementation details: function members
+    private:
+    void _flush();
+
+    // Implementation details: data members
+    private:
+    iterator _it;
+    size_type _remaining;
+    window_type _window;
+    size_type _buffered;
+};
+/* ************************************************************************** */
+
+
+
+// ------------------------- BIT READER: LIFECYCLE -------------------------- //
+// Explicitly constructs a reader over a range of bits
+template <class Iterator>
+bit_reader<Iterator>::bit_reader(
+    iterator first,
+    iterator last
+)
+: _it((_assert_range_viability(first, last), first))
+, _remaining(std::distance(first, last))
+, _window(0)
+, _buffered(0)
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- BIT READER: CAPACITY -------------------------- //
+// Checks whether all the bits have been read
+template <class Iterator>
+bool bit_reader<Iterator>::empty(
+) const noexcept
+{
+    return _buffered == 0 && _remaining == 0;
+}
+
+// Returns the number of bits left to read
+template <class Iterator>
+typename bit_reader<Iterator>::size_type bit_reader<Iterator>::size(
+) const noexcept
+{
+    return _buffered + _remaining;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------------- BIT READER: INPUT ---------------------------- //
+// Returns the next n bits without consuming them, padded with zeros at the end
+template <class Iterator>
+typename bit_reader<Iterator>::window_type bit_reader<Iterator>::peek(
+    size_type n
+)
+{
+    assert(n <= binary_digits<window_type>::value);
+    if (_buffered < n) {
+        _refill();
+    }
+    return _bextr<window_type>(_window, 0, n);
+}
+
+// Reads the next n bits as an unsigned integer
+template <class Iterator>
+typename bit_reader<Iterator>::window_type bit_reader<Iterator>::read(
+    size_type n
+)
+{
+    assert(n <= binary_digits<window_type>::value);
+    window_type value = 0;
+    if (_buffered < n) {
+        _refill();
+        if (_buffered < n) {
+            throw std::out_of_range("bit::bit_reader::read");
+        }
+    }
+    value = _bextr<window_type>(_window, 0, n);
+    _consume(n);
+    return value;
+}
+
+// Reads the number of zeros before the next one and consumes the one
+template <class Iterator>
+typename bit_reader<Iterator>::size_type bit_reader<Iterator>::read_unary(
+)
+{
+    size_type count = 0;
+    size_type zeros = 0;
+    for (;;) {
+        if (_buffered == 0) {
+            _refill();
+            if (_buffered == 0) {
+                throw std::out_of_range("bit::bit_reader::read_unary");
+            }
+        }
+        zeros = _tzcnt(_window);
+        if (zeros < _buffered) {
+            _consume(zeros + 1);
+            return count + zeros;
+        }
+        count += _buffered;
+        _consume(_buffered);
+    }
+}
+
+// Skips the next n bits
+template <class Iterator>
+void bit_reader<Iterator>::skip(
+    size_type n
+)
+{
+    if (n <= _buffered) {
+        _consume(n);
+    } else if (n - _buffered <= _remaining) {
+        n -= _buffered;
+        _consume(_buffered);
+        _it = std::next(_it, n);
+        _remaining -= n;
+    } else {
+        throw std::out_of_range("bit::bit_reader::skip");
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------- BIT READER: IMPLEMENTATION DETAILS: FUNCTION MEMBERS ---------- //
+// Fills the window with as many bits as possible, a word at a time
+template <class Iterator>
+void bit_reader<Iterator>::_refill(
+)
+{
+    using value_type = typename std::remove_cv<word_type>::type;
+    constexpr size_type digits = binary_digits<value_type>::value;
+    constexpr size_type window_digits = binary_digits<window_type>::value;
+    size_type len = 0;
+    window_type value = 0;
+    while (_buffered < window_digits && _remaining != 0) {
+        len = std::min(std::min(digits, window_digits - _buffered), _remaining);
+        value = _bextr<value_type>(
+            _read_word(_it.base(), _it.position(), len), 0, len
+        );
+        _window |= value << _buffered;
+        _buffered += len;
+        _remaining -= len;
+        _it = std::next(_it, len);
+    }
+}
+
+// Drops the n lsbs of the window
+template <class Iterator>
+void bit_reader<Iterator>::_consume(
+    size_type n
+) noexcept
+{
+    constexpr size_type window_digits = binary_digits<window_type>::value;
+    _window = n < window_digits ? _window >> n : 0;
+    _buffered -= n;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- BIT WRITER: LIFECYCLE -------------------------- //
+// Explicitly constructs a writer over a range of bits
+template <class Iterator>
+bit_writer<Iterator>::bit_writer(
+    iterator first,
+    iterator last
+)
+: _it((_assert_range_viability(first, last), first))
+, _remaining(std::distance(first, last))
+, _window(0)
+, _buffered(0)
+{
+}
+
+// Writes the buffered bits and destructs the writer
+template <class Iterator>
+bit_writer<Iterator>::~bit_writer(
+)
+{
+    _flush();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- BIT WRITER: CAPACITY -------------------------- //
+// Checks whether there is no room left to write
+template <class Iterator>
+bool bit_writer<Iterator>::empty(
+) const noexcept
+{
+    return _buffered == _remaining;
+}
+
+// Returns the number of bits that can still be written
+template <class Iterator>
+typename bit_writer<Iterator>::size_type bit_writer<Iterator>::size(
+) const noexcept
+{
+    return _remaining - _buffered;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------------- BIT WRITER: OUTPUT --------------------------- //
+// Writes the n lsbs of a value
+template <class Iterator>
+void bit_writer<Iterator>::write(
+    window_type value,
+    size_type n
+)
+{
+    // Assertions and constants
+    assert(n <= binary_digits<window_type>::value);
+    constexpr size_type window_digits = binary_digits<window_type>::value;
+
+    // Initialization
+    const size_type buffered = _buffered;
+    if (n > _remaining - _buffered) {
+        throw std::out_of_range("bit::bit_writer::write");
+    }
+
+    // Append the bits and write the window once it is full
+    value = _bextr<window_type>(value, 0, n);
+    _window |= value << buffered;
+    if (buffered + n < window_digits) {
+        _buffered += n;
+    } else {
+        _buffered = window_digits;
+        _flush();
+        _window = buffered ? value >> (window_digits - buffered) : 0;
+        _buffered = buffered + n - window_digits;
+    }
+}
+
+// Writes n zeros followed by a one
+template <class Iterator>
+void bit_writer<Iterator>::write_unary(
+    size_type n
+)
+{
+    constexpr size_type window_digits = binary_digits<window_type>::value;
+    constexpr window_type one = 1;
+    if (n >= _remaining - _buffered) {
+        throw std::out_of_range("bit::bit_writer::write_unary");
+    }
+    for (; n >= window_digits; n -= window_digits) {
+        write(0, window_digits);
+    }
+    write(one << n, n + 1);
+}
+
+// Writes the buffered bits and returns the end of the written bits
+template <class Iterator>
+typename bit_writer<Iterator>::iterator bit_writer<Iterator>::flush(
+)
+{
+    _flush();
+    return _it;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------- BIT WRITER: IMPLEMENTATION DETAILS: FUNCTION MEMBERS ---------- //
+// Writes the buffered bits to the range, a word at a time
+template <class Iterator>
+void bit_writer<Iterator>::_flush(
+)
+{
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr size_type window_digits = binary_digits<window_type>::value;
+    size_type len = 0;
+    while (_buffered != 0) {
+        len = std::min(digits, _buffered);
+        _write_word(
+            _it.base(),
+            _it.position(),
+            len,
+            static_cast<word_type>(_window)
+        );
+        _window = len < window_digits ? _window >> len : 0;
+        _buffered -= len;
+        _remaining -= len;
+        _it = std::next(_it, len);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _BIT_STREAM_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,261 @@
+// ============================= BIT TRANSPOSE ============================== //
+// Project:         The C++ Bit Library
+// Name:            bit_transpose.hpp
+// Description:     Transposition of square blocks and matrices of bits
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2015-2017]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_TRANSPOSE_HPP_INCLUDED
+#define _BIT_TRANSPOSE_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cstdint>
+// Project sources
+#include "bit_details.hpp"
+#include "bit_value.hpp"
+#include "bit_reference.hpp"
+#include "bit_pointer.hpp"
+#include "bit_iterator.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* ***************************** TRANSPOSITION ****************************** */
+// Square blocks
+template <class RandomIt>
+void transpose(RandomIt first);
+
+// Matrices
+template <class InputIt, class OutputIt>
+void transpose(
+    bit_iterator<InputIt> first,
+    typename bit_iterator<InputIt>::size_type rows,
+    typename bit_iterator<InputIt>::size_type cols,
+    typename bit_iterator<InputIt>::difference_type stride,
+    bit_iterator<OutputIt> d_first,
+    typename bit_iterator<OutputIt>::difference_type d_stride
+);
+/* ************************************************************************** */
+
+
+
+/* ***************** IMPLEMENTATION DETAILS: TRANSPOSITION ****************** */
+// Kernels
+constexpr std::uint64_t _transpose_mul(std::uint64_t src) noexcept;
+template <class T>
+void _transpose_swap(T* block) noexcept;
+#if defined(__SSE2__)
+inline void _transpose_sse2(std::uint16_t* block) noexcept;
+#endif
+
+// Dispatch
+template <class T>
+void _transpose_block(T* block) noexcept;
+inline void _transpose_block(std::uint8_t* block) noexcept;
+#if defined(__SSE2__)
+inline void _transpose_block(std::uint16_t* block) noexcept;
+#endif
+/* ************************************************************************** */
+
+
+
+// ---------------------- TRANSPOSITION: SQUARE BLOCKS ---------------------- //
+// Transposes in place the square block formed by the next digits words
+template <class RandomIt>
+void transpose(
+    RandomIt first
+)
+{
+    using word_type = typename std::remove_cv<
+        typename std::iterator_traits<RandomIt>::value_type
+    >::type;
+    constexpr std::size_t digits = binary_digits<word_type>::value;
+    word_type block[digits];
+    std::copy(first, std::next(first, digits), block);
+    _transpose_block(block);
+    std::copy(block, block + digits, first);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ TRANSPOSITION: MATRICES ------------------------- //
+// Transposes a matrix of rows of cols bits, stride bits apart, to a matrix of
+// cols rows of rows bits, d_stride bits apart, one square tile at a time
+template <class InputIt, class OutputIt>
+void transpose(
+    bit_iterator<InputIt> first,
+    typename bit_iterator<InputIt>::size_type rows,
+    typename bit_iterator<InputIt>::size_type cols,
+    typename bit_iterator<InputIt>::difference_type stride,
+    bit_iterator<OutputIt> d_first,
+    typename bit_iterator<OutputIt>::difference_type d_stride
+)
+{
+    // Types and constants
+    using src_word_type = typename bit_iterator<InputIt>::word_type;
+    using dst_word_type = typename bit_iterator<OutputIt>::word_type;
+    using word_type = typename std::remove_cv<dst_word_type>::type;
+    using size_type = typename bit_iterator<OutputIt>::size_type;
+    using difference_type = typename bit_iterator<OutputIt>::difference_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    static_assert(std::is_same<
+        typename std::remove_cv<src_word_type>::type, word_type
+    >::value, "");
+
+    // Initialization
+    word_type block[digits] = {};
+    bit_iterator<InputIt> it = first;
+    bit_iterator<OutputIt> d_it = d_first;
+    size_type row_len = 0;
+    size_type col_len = 0;
+    size_type i = 0;
+
+    // Read a tile, transpose it in registers and write it to its mirror tile
+    for (size_type row = 0; row < rows; row += digits) {
+        row_len = std::min(digits, rows - row);
+        for (size_type col = 0; col < cols; col += digits) {
+            col_len = std::min(digits, cols - col);
+            for (i = 0; i < row_len; ++i) {
+                it = first
+                   + static_cast<difference_type>(row + i) * stride
+                   + static_cast<difference_type>(col);
+                block[i] = _bextr<word_type>(
+                    _read_word(it.base(), it.position(), col_len), 0, col_len
+                );
+            }
+            for (; i < digits; ++i) {
+                block[i] = 0;
+            }
+            _transpose_block(block);
+            for (i = 0; i < col_len; ++i) {
+                d_it = d_first
+                     + static_cast<difference_type>(col + i) * d_stride
+                     + static_cast<difference_type>(row);
+                _write_word(d_it.base(), d_it.position(), row_len, block[i]);
+            }
+        }
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------- IMPLEMENTATION DETAILS: TRANSPOSITION: KERNELS ------------- //
+// Transposes an 8x8 block of bytes by gathering each column with a multiply
+constexpr std::uint64_t _transpose_mul(
+    std::uint64_t src
+) noexcept
+{
+    constexpr std::uint64_t column = 0x0101010101010101ULL;
+    constexpr std::uint64_t gather = 0x0102040810204080ULL;
+    constexpr std::size_t size = 8;
+    constexpr std::size_t shift = (size - 1) * size;
+    std::uint64_t dst = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        dst |= (((src >> i) & column) * gather >> shift) << (i * size);
+    }
+    return dst;
+}
+
+// Transposes a square block by swapping its quadrants recursively
+template <class T>
+void _transpose_swap(
+    T* block
+) noexcept
+{
+    constexpr std::size_t digits = binary_digits<T>::value;
+    constexpr T ones = std::numeric_limits<T>::max();
+    static_assert(digits && (digits & (digits - 1)) == 0, "");
+    T msk = static_cast<T>(ones >> (digits / 2));
+    T tmp = 0;
+    for (std::size_t j = digits / 2; j != 0; j >>= 1) {
+        for (std::size_t k = 0; k < digits; k = (k + j + 1) & ~j) {
+            tmp = ((block[k] >> j) ^ block[k + j]) & msk;
+            block[k] ^= static_cast<T>(tmp << j);
+            block[k + j] ^= tmp;
+        }
+        msk ^= static_cast<T>(msk << (j / 2));
+    }
+}
+
+#if defined(__SSE2__)
+// Transposes a 16x16 block by extracting each bit plane with movemask
+inline void _transpose_sse2(
+    std::uint16_t* block
+) noexcept
+{
+    constexpr std::size_t digits = binary_digits<std::uint16_t>::value;
+    constexpr std::size_t half = digits / 2;
+    const __m128i msk = _mm_set1_epi16(0x00FF);
+    const __m128i src0 = _mm_loadu_si128(reinterpret_cast<__m128i*>(block));
+    const __m128i src1 = _mm_loadu_si128(
+        reinterpret_cast<__m128i*>(block + half)
+    );
+    __m128i lo = _mm_packus_epi16(
+        _mm_and_si128(src0, msk),
+        _mm_and_si128(src1, msk)
+    );
+    __m128i hi = _mm_packus_epi16(
+        _mm_srli_epi16(src0, half),
+        _mm_srli_epi16(src1, half)
+    );
+    for (std::size_t i = half; i-- > 0;) {
+        block[i] = static_cast<std::uint16_t>(_mm_movemask_epi8(lo));
+        block[i + half] = static_cast<std::uint16_t>(_mm_movemask_epi8(hi));
+        lo = _mm_add_epi8(lo, lo);
+        hi = _mm_add_epi8(hi, hi);
+    }
+}
+#endif
+
+// Transposes a square block of words with the swap network
+template <class T>
+void _transpose_block(
+    T* block
+) noexcept
+{
+    _transpose_swap(block);
+}
+
+// Transposes a square block of bytes with the multiply gather
+inline void _transpose_block(
+    std::uint8_t* block
+) noexcept
+{
+    constexpr std::size_t digits = binary_digits<std::uint8_t>::value;
+    std::uint64_t src = 0;
+    for (std::size_t i = 0; i < digits; ++i) {
+        src |= static_cast<std::uint64_t>(block[i]) << (i * digits);
+    }
+    src = _transpose_mul(src);
+    for (std::size_t i = 0; i < digits; ++i) {
+        block[i] = static_cast<std::uint8_t>(src >> (i * digits));
+    }
+}
+
+#if defined(__SSE2__)
+// Transposes a square block of 16-bit words with movemask
+inline void _transpose_block(
+    std::uint16_t* block
+) noexcept
+{
+    _transpose_sse2(block);
+}
+#endif
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _BIT_TRANSPOSE_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,989 @@
+// =============================== BIT VECTOR =============================== //
+// Project:         The C++ Bit Library
+// Name:            bit_vector.hpp
+// Description:     A dynamic container of bits with inline small storage
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2015-2017]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_VECTOR_HPP_INCLUDED
+#define _BIT_VECTOR_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <memory>
+#include <initializer_list>
+// Project sources
+#include "bit_details.hpp"
+#include "bit_value.hpp"
+#include "bit_reference.hpp"
+#include "bit_pointer.hpp"
+#include "bit_iterator.hpp"
+#include "bit_algorithm.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* ******************************* BIT VECTOR ******************************* */
+// Bit vector class definition
+template <class WordType, class Allocator = std::allocator<WordType>>
+class bit_vector
+{
+    // Assertions
+    static_assert(binary_digits<WordType>::value, "");
+    static_assert(std::is_same<
+        typename std::allocator_traits<Allocator>::value_type, WordType
+    >::value, "");
+
+    // Types
+    public:
+    using word_type = WordType;
+    using allocator_type = Allocator;
+    using value_type = bit_value;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = bit_reference<word_type>;
+    using const_reference = bit_reference<const word_type>;
+    using pointer = bit_pointer<word_type>;
+    using const_pointer = bit_pointer<const word_type>;
+    using iterator = bit_iterator<word_type*>;
+    using const_iterator = bit_iterator<const word_type*>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // Lifecycle
+    public:
+    bit_vector();
+    explicit bit_vector(const allocator_type& alloc);
+    explicit bit_vector(
+        size_type count,
+        const allocator_type& alloc = allocator_type()
+    );
+    bit_vector(
+        size_type count,
+        bit_value value,
+        const allocator_type& alloc = allocator_type()
+    );
+    template <class Iterator>
+    bit_vector(
+        bit_iterator<Iterator> first,
+        bit_iterator<Iterator> last,
+        const allocator_type& alloc = allocator_type()
+    );
+    bit_vector(
+        std::initializer_list<bit_value> init,
+        const allocator_type& alloc = allocator_type()
+    );
+    bit_vector(const bit_vector& other);
+    bit_vector(bit_vector&& other) noexcept;
+    ~bit_vector();
+
+    // Assignment
+    public:
+    bit_vector& operator=(const bit_vector& other);
+    bit_vector& operator=(bit_vector&& other);
+    bit_vector& operator=(std::initializer_list<bit_value> init);
+    void assign(size_type count, bit_value value);
+    template <class Iterator>
+    void assign(bit_iterator<Iterator> first, bit_iterator<Iterator> last);
+    void assign(std::initializer_list<bit_value> init);
+    allocator_type get_allocator() const;
+
+    // Element access
+    public:
+    reference at(size_type pos);
+    const_reference at(size_type pos) const;
+    reference operator[](size_type pos);
+    const_reference operator[](size_type pos) const;
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+    word_type* data() noexcept;
+    const word_type* data() const noexcept;
+
+    // Iterators
+    public:
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+    reverse_iterator rbegin() noexcept;
+    const_reverse_iterator rbegin() const noexcept;
+    const_reverse_iterator crbegin() const noexcept;
+    reverse_iterator rend() noexcept;
+    const_reverse_iterator rend() const noexcept;
+    const_reverse_iterator crend() const noexcept;
+
+    // Capacity
+    public:
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+    size_type max_size() const noexcept;
+    void reserve(size_type count);
+    size_type capacity() const noexcept;
+    void shrink_to_fit();
+
+    // Modifiers
+    public:
+    void clear() noexcept;
+    iterator insert(const_iterator pos, bit_value value);
+    iterator insert(const_iterator pos, size_type count, bit_value value);
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+    void push_back(bit_value value);
+    void pop_back();
+    void resize(size_type count);
+    void resize(size_type count, bit_value value);
+    void swap(bit_vector& other) noexcept;
+
+    // Implementation details: function members
+    private:
+    static constexpr size_type _words(size_type count) noexcept;
+    bool _is_small() const noexcept;
+    void _grow(size_type count);
+    void _reallocate(size_type capacity);
+    void _release() noexcept;
+
+    // Implementation details: data members
+    private:
+    using _traits_t = std::allocator_traits<allocator_type>;
+    static constexpr size_type _digits = binary_digits<word_type>::value;
+    static constexpr size_type _small_capacity = (sizeof(void*) * 2
+                                               + sizeof(word_type) - 1)
+                                               / sizeof(word_type);
+    allocator_type _allocator;
+    word_type* _data;
+    size_type _size;
+    size_type _capacity;
+    word_type _buffer[_small_capacity];
+};
+
+// Comparison operators
+template <class WordType, class Allocator>
+bool operator==(
+    const bit_vector<WordType, Allocator>& lhs,
+    const bit_vector<WordType, Allocator>& rhs
+);
+template <class WordType, class Allocator>
+bool operator!=(
+    const bit_vector<WordType, Allocator>& lhs,
+    const bit_vector<WordType, Allocator>& rhs
+);
+
+// Swap
+template <class WordType, class Allocator>
+void swap(
+    bit_vector<WordType, Allocator>& lhs,
+    bit_vector<WordType, Allocator>& rhs
+) noexcept;
+/* ************************************************************************** */
+
+
+
+// ------------------------- BIT VECTOR: LIFECYCLE -------------------------- //
+// Implicitly default constructs an empty bit vector using the inline storage
+template <class WordType, class Allocator>
+bit_vector<WordType, Allocator>::bit_vector(
+)
+: _allocator()
+, _data(_buffer)
+, _size(0)
+, _capacity(_small_capacity)
+, _buffer()
+{
+}
+
+// Explicitly constructs an empty bit vector with the provided allocator
+template <class WordType, class Allocator>
+bit_vector<WordType, Allocator>::bit_vector(
+    const allocator_type& alloc
+)
+: _allocator(alloc)
+, _data(_buffer)
+, _size(0)
+, _capacity(_small_capacity)
+, _buffer()
+{
+}
+
+// Explicitly constructs a bit vector of count zero bits
+template <class WordType, class Allocator>
+bit_vector<WordType, Allocator>::bit_vector(
+    size_type count,
+    const allocator_type& alloc
+)
+: bit_vector(alloc)
+{
+    resize(count);
+}
+
+// Constructs a bit vector of count bits set to the provided value
+template <class WordType, class Allocator>
+bit_vector<WordType, Allocator>::bit_vector(
+    size_type count,
+    bit_value value,
+    const allocator_type& alloc
+)
+: bit_vector(alloc)
+{
+    resize(count, value);
+}
+
+// Constructs a bit vector from a range of bits
+template <class WordType, class Allocator>
+template <class Iterator>
+bit_vector<WordType, Allocator>::bit_vector(
+    bit_iterator<Iterator> first,
+    bit_iterator<Iterator> last,
+    const allocator_type& alloc
+)
+: bit_vector(alloc)
+{
+    assign(first, last);
+}
+
+// Constructs a bit vector from an initializer list of bits
+template <class WordType, class Allocator>
+bit_vector<WordType, Allocator>::bit_vector(
+    std::initializer_list<bit_value> init,
+    const allocator_type& alloc
+)
+: bit_vector(alloc)
+{
+    assign(init);
+}
+
+// Copy constructs a bit vector
+template <class WordType, class Allocator>
+bit_vector<WordType, Allocator>::bit_vector(
+    const bit_vector& other
+)
+: bit_vector(_traits_t::select_on_container_copy_construction(
+    other._allocator
+))
+{
+    reserve(other._size);
+    std::copy(other._data, other._data + _words(other._size), _data);
+    _size = other._size;
+}
+
+// Move constructs a bit vector, stealing the heap storage if any
+template <class WordType, class Allocator>
+bit_vector<WordType, Allocator>::bit_vector(
+    bit_vector&& other
+) noexcept
+: _allocator(std::move(other._allocator))
+, _data(_buffer)
+, _size(other._size)
+, _capacity(_small_capacity)
+, _buffer()
+{
+    if (other._is_small()) {
+        std::copy(other._buffer, other._buffer + _small_capacity, _buffer);
+    } else {
+        _data = other._data;
+        _capacity = other._capacity;
+        other._data = other._buffer;
+        other._capacity = _small_capacity;
+    }
+    other._size = 0;
+}
+
+// Destructs the bit vector, releasing the heap storage if any
+template <class WordType, class Allocator>
+bit_vector<WordType, Allocator>::~bit_vector(
+)
+{
+    _release();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- BIT VECTOR: ASSIGNMENT ------------------------- //
+// Copies the bits of another bit vector to the bit vector, propagating the
+// allocator if required and releasing the storage it cannot deallocate
+template <class WordType, class Allocator>
+bit_vector<WordType, Allocator>& bit_vector<WordType, Allocator>::operator=(
+    const bit_vector& other
+)
+{
+    using propagate_t = typename std::allocator_traits<
+        allocator_type
+    >::propagate_on_container_copy_assignment;
+    if (this != &other) {
+        if (propagate_t::value) {
+            if (_allocator != other._allocator) {
+                _release();
+                _data = _buffer;
+                _capacity = _small_capacity;
+            }
+            _allocator = other._allocator;
+        }
+        clear();
+        reserve(other._size);
+        std::copy(other._data, other._data + _words(other._size), _data);
+        _size = other._size;
+    }
+    return *this;
+}
+
+// Moves another bit vector to the bit vector
+template <class WordType, class Allocator>
+bit_vector<WordType, Allocator>& bit_vector<WordType, Allocator>::operator=(
+    bit_vector&& other
+)
+{
+    using propagate_t = typename std::allocator_traits<
+        allocator_type
+    >::propagate_on_container_move_assignment;
+    const bool is_stealable = !other._is_small()
+                           && (propagate_t::value
+                           || _allocator == other._allocator);
+    if (this != &other) {
+        if (is_stealable) {
+            _release();
+            if (propagate_t::value) {
+                _allocator = std::move(other._allocator);
+            }
+            _data = other._data;
+            _capacity = other._capacity;
+            _size = other._size;
+            other._data = other._buffer;
+            other._capacity = _small_capacity;
+        } else {
+            *this = static_cast<const bit_vector&>(other);
+        }
+        other._size = 0;
+    }
+    return *this;
+}
+
+// Assigns the bits of an initializer list to the bit vector
+template <class WordType, class Allocator>
+bit_vector<WordType, Allocator>& bit_vector<WordType, Allocator>::operator=(
+    std::initializer_list<bit_value> init
+)
+{
+    assign(init);
+    return *this;
+}
+
+// Assigns count bits set to the provided value to the bit vector
+template <class WordType, class Allocator>
+void bit_vector<WordType, Allocator>::assign(
+    size_type count,
+    bit_value value
+)
+{
+    clear();
+    resize(count, value);
+}
+
+// Assigns the bits of a range to the bit vector
+template <class WordType, class Allocator>
+template <class Iterator>
+void bit_vector<WordType, Allocator>::assign(
+    bit_iterator<Iterator> first,
+    bit_iterator<Iterator> last
+)
+{
+    const size_type count = std::distance(first, last);
+    clear();
+    reserve(count);
+    if (count != 0) {
+        _data[_words(count) - 1] = word_type();
+    }
+    _size = count;
+    bit::copy(first, last, begin());
+}
+
+// Assigns the bits of an initializer list to the bit vector
+template <class WordType, class Allocator>
+void bit_vector<WordType, Allocator>::assign(
+    std::initializer_list<bit_value> init
+)
+{
+    clear();
+    reserve(init.size());
+    for (bit_value value: init) {
+        push_back(value);
+    }
+}
+
+// Returns a copy of the allocator
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::allocator_type
+bit_vector<WordType, Allocator>::get_allocator(
+) const
+{
+    return _allocator;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- BIT VECTOR: ELEMENT ACCESS ----------------------- //
+// Gets a reference to the bit at the provided position with bounds checking
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::reference
+bit_vector<WordType, Allocator>::at(
+    size_type pos
+)
+{
+    if (pos >= _size) {
+        throw std::out_of_range("bit_vector::at");
+    }
+    return (*this)[pos];
+}
+
+// Gets a constant reference to the bit at the provided position with checks
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::const_reference
+bit_vector<WordType, Allocator>::at(
+    size_type pos
+) const
+{
+    if (pos >= _size) {
+        throw std::out_of_range("bit_vector::at");
+    }
+    return (*this)[pos];
+}
+
+// Gets a reference to the bit at the provided position
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::reference
+bit_vector<WordType, Allocator>::operator[](
+    size_type pos
+)
+{
+    return reference(_data[pos / _digits], pos % _digits);
+}
+
+// Gets a constant reference to the bit at the provided position
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::const_reference
+bit_vector<WordType, Allocator>::operator[](
+    size_type pos
+) const
+{
+    return const_reference(_data[pos / _digits], pos % _digits);
+}
+
+// Gets a reference to the first bit
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::reference
+bit_vector<WordType, Allocator>::front(
+)
+{
+    return (*this)[0];
+}
+
+// Gets a constant reference to the first bit
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::const_reference
+bit_vector<WordType, Allocator>::front(
+) const
+{
+    return (*this)[0];
+}
+
+// Gets a reference to the last bit
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::reference
+bit_vector<WordType, Allocator>::back(
+)
+{
+    return (*this)[_size - 1];
+}
+
+// Gets a constant reference to the last bit
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::const_reference
+bit_vector<WordType, Allocator>::back(
+) const
+{
+    return (*this)[_size - 1];
+}
+
+// Gets a pointer to the underlying words, the unused bits being zero
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::word_type*
+bit_vector<WordType, Allocator>::data(
+) noexcept
+{
+    return _data;
+}
+
+// Gets a constant pointer to the underlying words, the unused bits being zero
+template <class WordType, class Allocator>
+const typename bit_vector<WordType, Allocator>::word_type*
+bit_vector<WordType, Allocator>::data(
+) const noexcept
+{
+    return _data;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- BIT VECTOR: ITERATORS -------------------------- //
+// Returns an iterator to the first bit
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::iterator
+bit_vector<WordType, Allocator>::begin(
+) noexcept
+{
+    return iterator(_data);
+}
+
+// Returns a constant iterator to the first bit
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::const_iterator
+bit_vector<WordType, Allocator>::begin(
+) const noexcept
+{
+    return const_iterator(_data);
+}
+
+// Returns a constant iterator to the first bit
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::const_iterator
+bit_vector<WordType, Allocator>::cbegin(
+) const noexcept
+{
+    return const_iterator(_data);
+}
+
+// Returns an iterator past the last bit
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::iterator
+bit_vector<WordType, Allocator>::end(
+) noexcept
+{
+    return iterator(_data + _size / _digits, _size % _digits);
+}
+
+// Returns a constant iterator past the last bit
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::const_iterator
+bit_vector<WordType, Allocator>::end(
+) const noexcept
+{
+    return const_iterator(_data + _size / _digits, _size % _digits);
+}
+
+// Returns a constant iterator past the last bit
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::const_iterator
+bit_vector<WordType, Allocator>::cend(
+) const noexcept
+{
+    return const_iterator(_data + _size / _digits, _size % _digits);
+}
+
+// Returns a reverse iterator to the last bit
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::reverse_iterator
+bit_vector<WordType, Allocator>::rbegin(
+) noexcept
+{
+    return reverse_iterator(end());
+}
+
+// Returns a constant reverse iterator to the last bit
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::const_reverse_iterator
+bit_vector<WordType, Allocator>::rbegin(
+) const noexcept
+{
+    return const_reverse_iterator(end());
+}
+
+// Returns a constant reverse iterator to the last bit
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::const_reverse_iterator
+bit_vector<WordType, Allocator>::crbegin(
+) const noexcept
+{
+    return const_reverse_iterator(cend());
+}
+
+// Returns a reverse iterator before the first bit
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::reverse_iterator
+bit_vector<WordType, Allocator>::rend(
+) noexcept
+{
+    return reverse_iterator(begin());
+}
+
+// Returns a constant reverse iterator before the first bit
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::const_reverse_iterator
+bit_vector<WordType, Allocator>::rend(
+) const noexcept
+{
+    return const_reverse_iterator(begin());
+}
+
+// Returns a constant reverse iterator before the first bit
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::const_reverse_iterator
+bit_vector<WordType, Allocator>::crend(
+) const noexcept
+{
+    return const_reverse_iterator(cbegin());
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- BIT VECTOR: CAPACITY -------------------------- //
+// Checks whether the bit vector is empty
+template <class WordType, class Allocator>
+bool bit_vector<WordType, Allocator>::empty(
+) const noexcept
+{
+    return _size == 0;
+}
+
+// Returns the number of bits
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::size_type
+bit_vector<WordType, Allocator>::size(
+) const noexcept
+{
+    return _size;
+}
+
+// Returns the maximum number of bits the bit vector can hold
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::size_type
+bit_vector<WordType, Allocator>::max_size(
+) const noexcept
+{
+    constexpr size_type max = std::numeric_limits<size_type>::max();
+    const size_type words = _traits_t::max_size(_allocator);
+    return words < max / _digits ? words * _digits : max;
+}
+
+// Reserves the storage for at least count bits
+template <class WordType, class Allocator>
+void bit_vector<WordType, Allocator>::reserve(
+    size_type count
+)
+{
+    if (_words(count) > _capacity) {
+        _reallocate(_words(count));
+    }
+}
+
+// Returns the number of bits that can be held without reallocation
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::size_type
+bit_vector<WordType, Allocator>::capacity(
+) const noexcept
+{
+    return _capacity * _digits;
+}
+
+// Releases the unused words, moving back to the inline storage if possible
+template <class WordType, class Allocator>
+void bit_vector<WordType, Allocator>::shrink_to_fit(
+)
+{
+    if (_words(_size) < _capacity && !_is_small()) {
+        _reallocate(_words(_size));
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- BIT VECTOR: MODIFIERS -------------------------- //
+// Removes all the bits, keeping the allocated storage
+template <class WordType, class Allocator>
+void bit_vector<WordType, Allocator>::clear(
+) noexcept
+{
+    _size = 0;
+}
+
+// Inserts a bit before the provided position
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::iterator
+bit_vector<WordType, Allocator>::insert(
+    const_iterator pos,
+    bit_value value
+)
+{
+    return insert(pos, 1, value);
+}
+
+// Inserts count bits set to the provided value before the provided position
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::iterator
+bit_vector<WordType, Allocator>::insert(
+    const_iterator pos,
+    size_type count,
+    bit_value value
+)
+{
+    const size_type idx = pos - cbegin();
+    const size_type size = _size;
+    resize(_size + count);
+    bit::copy_backward(begin() + idx, begin() + size, end());
+    bit::fill(begin() + idx, begin() + idx + count, value);
+    return begin() + idx;
+}
+
+// Erases the bit at the provided position
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::iterator
+bit_vector<WordType, Allocator>::erase(
+    const_iterator pos
+)
+{
+    return erase(pos, std::next(pos));
+}
+
+// Erases the bits in the provided range
+template <class WordType, class Allocator>
+typename bit_vector<WordType, Allocator>::iterator
+bit_vector<WordType, Allocator>::erase(
+    const_iterator first,
+    const_iterator last
+)
+{
+    const size_type idx = first - cbegin();
+    const size_type count = last - first;
+    bit::copy(begin() + (idx + count), end(), begin() + idx);
+    resize(_size - count);
+    return begin() + idx;
+}
+
+// Appends a bit, growing the storage one word at a time at most
+template <class WordType, class Allocator>
+void bit_vector<WordType, Allocator>::push_back(
+    bit_value value
+)
+{
+    const size_type pos = _size % _digits;
+    const word_type bit = static_cast<bool>(value);
+    if (_size == _capacity * _digits) {
+        _grow(_size + 1);
+    }
+    if (pos == 0) {
+        _data[_size / _digits] = bit;
+    } else {
+        _data[_size / _digits] |= static_cast<word_type>(bit << pos);
+    }
+    ++_size;
+}
+
+// Removes the last bit
+template <class WordType, class Allocator>
+void bit_vector<WordType, Allocator>::pop_back(
+)
+{
+    --_size;
+    _data[_size / _digits] &= static_cast<word_type>(~(
+        static_cast<word_type>(1) << (_size % _digits)
+    ));
+}
+
+// Resizes the bit vector, the new bits being zero
+template <class WordType, class Allocator>
+void bit_vector<WordType, Allocator>::resize(
+    size_type count
+)
+{
+    resize(count, bit0);
+}
+
+// Resizes the bit vector, the new bits being set to the provided value
+template <class WordType, class Allocator>
+void bit_vector<WordType, Allocator>::resize(
+    size_type count,
+    bit_value value
+)
+{
+    const size_type size = _size;
+    if (count > size) {
+        _grow(count);
+        std::fill(_data + _words(size), _data + _words(count), word_type());
+        _size = count;
+        if (value) {
+            bit::fill(begin() + size, end(), value);
+        }
+    } else if (count < size) {
+        _size = count;
+        bit::fill(end(), begin() + _words(count) * _digits, bit0);
+    }
+}
+
+// Swaps the contents of the bit vector with another bit vector member-wise,
+// exchanging the heap storage pointers and only copying the inline buffers
+template <class WordType, class Allocator>
+void bit_vector<WordType, Allocator>::swap(
+    bit_vector& other
+) noexcept
+{
+    using std::swap;
+    using propagate_t = typename std::allocator_traits<
+        allocator_type
+    >::propagate_on_container_swap;
+    const bool is_small = _is_small();
+    const bool is_other_small = other._is_small();
+    if (propagate_t::value) {
+        swap(_allocator, other._allocator);
+    }
+    if (!is_small && !is_other_small) {
+        swap(_data, other._data);
+        swap(_capacity, other._capacity);
+    } else if (is_small && is_other_small) {
+        std::swap_ranges(_buffer, _buffer + _small_capacity, other._buffer);
+    } else {
+        bit_vector& small = is_small ? *this : other;
+        bit_vector& large = is_small ? other : *this;
+        std::copy(
+            small._buffer,
+            small._buffer + _small_capacity,
+            large._buffer
+        );
+        small._data = large._data;
+        small._capacity = large._capacity;
+        large._data = large._buffer;
+        large._capacity = _small_capacity;
+    }
+    swap(_size, other._size);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- BIT VECTOR: COMPARISON OPERATORS -------------------- //
+// Checks if the left hand side is equal to the right hand side
+template <class WordType, class Allocator>
+bool operator==(
+    const bit_vector<WordType, Allocator>& lhs,
+    const bit_vector<WordType, Allocator>& rhs
+)
+{
+    constexpr std::size_t digits = binary_digits<WordType>::value;
+    const std::size_t words = (lhs.size() + digits - 1) / digits;
+    return lhs.size() == rhs.size()
+        && std::equal(lhs.data(), lhs.data() + words, rhs.data());
+}
+
+// Checks if the left hand side is non equal to the right hand side
+template <class WordType, class Allocator>
+bool operator!=(
+    const bit_vector<WordType, Allocator>& lhs,
+    const bit_vector<WordType, Allocator>& rhs
+)
+{
+    return !(lhs == rhs);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------------- BIT VECTOR: SWAP ---------------------------- //
+// Swaps two bit vectors
+template <class WordType, class Allocator>
+void swap(
+    bit_vector<WordType, Allocator>& lhs,
+    bit_vector<WordType, Allocator>& rhs
+) noexcept
+{
+    lhs.swap(rhs);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------- BIT VECTOR: IMPLEMENTATION DETAILS: FUNCTION MEMBERS ---------- //
+// Computes the number of words needed to store count bits
+template <class WordType, class Allocator>
+constexpr typename bit_vector<WordType, Allocator>::size_type
+bit_vector<WordType, Allocator>::_words(
+    size_type count
+) noexcept
+{
+    return count / _digits + (count % _digits != 0);
+}
+
+// Checks whether the bits are stored in the inline storage
+template <class WordType, class Allocator>
+bool bit_vector<WordType, Allocator>::_is_small(
+) const noexcept
+{
+    return _data == _buffer;
+}
+
+// Makes room for count bits, at least doubling the capacity if reallocating
+template <class WordType, class Allocator>
+void bit_vector<WordType, Allocator>::_grow(
+    size_type count
+)
+{
+    if (_words(count) > _capacity) {
+        _reallocate(std::max(_words(count), _capacity + _capacity));
+    }
+}
+
+// Moves the words to a storage of the provided capacity in words
+template <class WordType, class Allocator>
+void bit_vector<WordType, Allocator>::_reallocate(
+    size_type capacity
+)
+{
+    word_type* data = capacity > _small_capacity
+                    ? _traits_t::allocate(_allocator, capacity)
+                    : _buffer;
+    if (data != _data) {
+        std::copy(_data, _data + _words(_size), data);
+        _release();
+        _data = data;
+        _capacity = std::max(capacity, static_cast<size_type>(_small_capacity));
+    }
+}
+
+// Releases the heap storage if any
+template <class WordType, class Allocator>
+void bit_vector<WordType, Allocator>::_release(
+) noexcept
+{
+    if (!_is_small()) {
+        _traits_t::deallocate(_allocator, _data, _capacity);
+    }
+}
+
+// Number of binary digits of the underlying words
+template <class WordType, class Allocator>
+constexpr typename bit_vector<WordType, Allocator>::size_type
+bit_vector<WordType, Allocator>::_digits;
+
+// Number of words of the inline storage
+template <class WordType, class Allocator>
+constexpr typename bit_vector<WordType, Allocator>::size_type
+bit_vector<WordType, Allocator>::_small_capacity;
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _BIT_VECTOR_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,719 @@
+// ============================= BIT WORD BLOCK ============================= //
+// Project:         The C++ Bit Library
+// Name:            bit_word_block.hpp
+// Description:     A wide unsigned word made of a block of smaller words
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2015-2017]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_WORD_BLOCK_HPP_INCLUDED
+#define _BIT_WORD_BLOCK_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <array>
+#include <limits>
+#include <cstdint>
+#include <type_traits>
+// Project sources
+#include "bit_details.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* ******************************* WORD BLOCK ******************************* */
+// Word block class definition: an unsigned integer of N words, lsbs first
+template <class WordType, std::size_t N>
+class word_block
+{
+    // Assertions
+    static_assert(binary_digits<WordType>::value, "");
+    static_assert(N > 0, "");
+
+    // Types
+    public:
+    using word_type = WordType;
+    using size_type = std::size_t;
+    using array_type = std::array<word_type, N>;
+
+    // Lifecycle
+    public:
+    constexpr word_block() noexcept;
+    template <class T, class = typename std::enable_if<
+        std::is_integral<T>::value
+    >::type>
+    constexpr word_block(T val) noexcept;
+    explicit constexpr word_block(const array_type& words) noexcept;
+
+    // Element access
+    public:
+    constexpr word_type& operator[](size_type pos) noexcept;
+    constexpr const word_type& operator[](size_type pos) const noexcept;
+    constexpr word_type* data() noexcept;
+    constexpr const word_type* data() const noexcept;
+    static constexpr size_type size() noexcept;
+
+    // Conversion
+    public:
+    explicit constexpr operator bool() const noexcept;
+    template <class T, class = typename std::enable_if<
+        std::is_integral<T>::value
+    >::type>
+    explicit constexpr operator T() const noexcept;
+    constexpr array_type to_array() const noexcept;
+
+    // Compound assignment operators
+    public:
+    constexpr word_block& operator&=(const word_block& other) noexcept;
+    constexpr word_block& operator|=(const word_block& other) noexcept;
+    constexpr word_block& operator^=(const word_block& other) noexcept;
+    constexpr word_block& operator<<=(size_type n) noexcept;
+    constexpr word_block& operator>>=(size_type n) noexcept;
+    constexpr word_block& operator+=(const word_block& other) noexcept;
+    constexpr word_block& operator-=(const word_block& other) noexcept;
+    constexpr word_block& operator*=(const word_block& other) noexcept;
+
+    // Bitwise and arithmetic operators: hidden to convert integral operands
+    public:
+    friend constexpr word_block operator~(word_block src) noexcept
+    {
+        for (size_type i = 0; i < N; ++i) {
+            src._words[i] = static_cast<word_type>(~src._words[i]);
+        }
+        return src;
+    }
+    friend constexpr word_block operator&(
+        word_block lhs,
+        const word_block& rhs
+    ) noexcept
+    {
+        return lhs &= rhs;
+    }
+    friend constexpr word_block operator|(
+        word_block lhs,
+        const word_block& rhs
+    ) noexcept
+    {
+        return lhs |= rhs;
+    }
+    friend constexpr word_block operator^(
+        word_block lhs,
+        const word_block& rhs
+    ) noexcept
+    {
+        return lhs ^= rhs;
+    }
+    friend constexpr word_block operator<<(
+        word_block lhs,
+        const word_block& rhs
+    ) noexcept
+    {
+        return lhs <<= _shift_count(rhs);
+    }
+    friend constexpr word_block operator>>(
+        word_block lhs,
+        const word_block& rhs
+    ) noexcept
+    {
+        return lhs >>= _shift_count(rhs);
+    }
+    friend constexpr word_block operator+(
+        word_block lhs,
+        const word_block& rhs
+    ) noexcept
+    {
+        return lhs += rhs;
+    }
+    friend constexpr word_block operator-(
+        word_block lhs,
+        const word_block& rhs
+    ) noexcept
+    {
+        return lhs -= rhs;
+    }
+    friend constexpr word_block operator*(
+        word_block lhs,
+        const word_block& rhs
+    ) noexcept
+    {
+        return lhs *= rhs;
+    }
+
+    // Comparison operators: hidden to convert integral operands
+    public:
+    friend constexpr bool operator==(
+        const word_block& lhs,
+        const word_block& rhs
+    ) noexcept
+    {
+        return _compare(lhs, rhs) == 0;
+    }
+    friend constexpr bool operator!=(
+        const word_block& lhs,
+        const word_block& rhs
+    ) noexcept
+    {
+        return _compare(lhs, rhs) != 0;
+    }
+    friend constexpr bool operator<(
+        const word_block& lhs,
+        const word_block& rhs
+    ) noexcept
+    {
+        return _compare(lhs, rhs) < 0;
+    }
+    friend constexpr bool operator<=(
+        const word_block& lhs,
+        const word_block& rhs
+    ) noexcept
+    {
+        return _compare(lhs, rhs) <= 0;
+    }
+    friend constexpr bool operator>(
+        const word_block& lhs,
+        const word_block& rhs
+    ) noexcept
+    {
+        return _compare(lhs, rhs) > 0;
+    }
+    friend constexpr bool operator>=(
+        const word_block& lhs,
+        const word_block& rhs
+    ) noexcept
+    {
+        return _compare(lhs, rhs) >= 0;
+    }
+
+    // Implementation details: function members
+    private:
+    static constexpr size_type _shift_count(const word_block& src) noexcept;
+    static constexpr int _compare(
+        const word_block& lhs,
+        const word_block& rhs
+    ) noexcept;
+
+    // Implementation details: data members
+    private:
+    word_type _words[N];
+};
+
+// Binary digits structure specializations
+template <class WordType, std::size_t N>
+struct binary_digits<word_block<WordType, N>>
+: std::integral_constant<std::size_t, N * binary_digits<WordType>::value>
+{
+};
+template <class WordType, std::size_t N>
+struct binary_digits<const word_block<WordType, N>>
+: binary_digits<word_block<WordType, N>>
+{
+};
+template <class WordType, std::size_t N>
+struct binary_digits<volatile word_block<WordType, N>>
+: binary_digits<word_block<WordType, N>>
+{
+};
+template <class WordType, std::size_t N>
+struct binary_digits<const volatile word_block<WordType, N>>
+: binary_digits<word_block<WordType, N>>
+{
+};
+
+// Common word blocks
+using word_block256 = word_block<std::uint64_t, 4>;
+using word_block512 = word_block<std::uint64_t, 8>;
+/* ************************************************************************** */
+
+
+
+/* *************** IMPLEMENTATION DETAILS: WORD BLOCK TRAITS **************** */
+// Word block detection structure definition
+template <class T>
+struct _is_word_block
+: std::false_type
+{
+};
+template <class WordType, std::size_t N>
+struct _is_word_block<word_block<WordType, N>>
+: std::true_type
+{
+};
+/* ************************************************************************** */
+
+
+
+/* ************ IMPLEMENTATION DETAILS: WORD BLOCK INSTRUCTIONS ************* */
+// Population count
+template <class WordType, std::size_t N>
+constexpr std::size_t _popcnt(word_block<WordType, N> src) noexcept;
+
+// Leading zeros count
+template <class WordType, std::size_t N>
+constexpr std::size_t _lzcnt(word_block<WordType, N> src) noexcept;
+
+// Trailing zeros count
+template <class WordType, std::size_t N>
+constexpr std::size_t _tzcnt(word_block<WordType, N> src) noexcept;
+
+// Bit field extraction
+template <class T>
+constexpr typename std::enable_if<_is_word_block<T>::value, T>::type _bextr(
+    T src,
+    T start,
+    T len
+) noexcept;
+
+// Bit swap
+template <class WordType, std::size_t N>
+constexpr word_block<WordType, N> _bitswap(
+    word_block<WordType, N> src
+) noexcept;
+/* ************************************************************************** */
+
+
+
+// ------------------------- WORD BLOCK: LIFECYCLE -------------------------- //
+// Implicitly default constructs a word block set to zero
+template <class WordType, std::size_t N>
+constexpr word_block<WordType, N>::word_block(
+) noexcept
+: _words()
+{
+}
+
+// Implicitly constructs a word block from an integer, modulo its capacity
+template <class WordType, std::size_t N>
+template <class T, class>
+constexpr word_block<WordType, N>::word_block(
+    T val
+) noexcept
+: _words()
+{
+    using max_type = typename std::conditional<
+        std::is_signed<T>::value, std::intmax_t, std::uintmax_t
+    >::type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr size_type max_digits = binary_digits<std::uintmax_t>::value;
+    constexpr word_type ones = std::numeric_limits<word_type>::max();
+    const max_type src = static_cast<max_type>(val);
+    const std::uintmax_t bits = static_cast<std::uintmax_t>(src);
+    const word_type fill = src < max_type() ? ones : word_type();
+    for (size_type i = 0; i < N; ++i) {
+        if (i == 0) {
+            _words[i] = static_cast<word_type>(src);
+        } else if (i * digits < max_digits) {
+            _words[i] = static_cast<word_type>(bits >> (i * digits));
+        } else {
+            _words[i] = fill;
+        }
+    }
+}
+
+// Explicitly constructs a word block from an array of words, lsbs first
+template <class WordType, std::size_t N>
+constexpr word_block<WordType, N>::word_block(
+    const array_type& words
+) noexcept
+: _words()
+{
+    for (size_type i = 0; i < N; ++i) {
+        _words[i] = words[i];
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- WORD BLOCK: ELEMENT ACCESS ----------------------- //
+// Accesses the word at the provided position, the first word being the lsbs
+template <class WordType, std::size_t N>
+constexpr typename word_block<WordType, N>::word_type&
+word_block<WordType, N>::operator[](
+    size_type pos
+) noexcept
+{
+    return _words[pos];
+}
+
+// Accesses the word at the provided position, the first word being the lsbs
+template <class WordType, std::size_t N>
+constexpr const typename word_block<WordType, N>::word_type&
+word_block<WordType, N>::operator[](
+    size_type pos
+) const noexcept
+{
+    return _words[pos];
+}
+
+// Returns a pointer to the underlying words
+template <class WordType, std::size_t N>
+constexpr typename word_block<WordType, N>::word_type*
+word_block<WordType, N>::data(
+) noexcept
+{
+    return _words;
+}
+
+// Returns a pointer to the underlying words
+template <class WordType, std::size_t N>
+constexpr const typename word_block<WordType, N>::word_type*
+word_block<WordType, N>::data(
+) const noexcept
+{
+    return _words;
+}
+
+// Returns the number of underlying words
+template <class WordType, std::size_t N>
+constexpr typename word_block<WordType, N>::size_type
+word_block<WordType, N>::size(
+) noexcept
+{
+    return N;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- WORD BLOCK: CONVERSION ------------------------- //
+// Explicitly converts the word block to true if any of its bits is set
+template <class WordType, std::size_t N>
+constexpr word_block<WordType, N>::operator bool(
+) const noexcept
+{
+    word_type dst = word_type();
+    for (size_type i = 0; i < N; ++i) {
+        dst |= _words[i];
+    }
+    return dst != word_type();
+}
+
+// Explicitly converts the word block to an integer, keeping its lsbs
+template <class WordType, std::size_t N>
+template <class T, class>
+constexpr word_block<WordType, N>::operator T(
+) const noexcept
+{
+    using uint_type = typename std::make_unsigned<
+        typename std::conditional<std::is_same<T, bool>::value, int, T>::type
+    >::type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr size_type uint_digits = binary_digits<uint_type>::value;
+    uint_type dst = 0;
+    for (size_type i = 0; i < N && i * digits < uint_digits; ++i) {
+        dst |= static_cast<uint_type>(_words[i]) << (i * digits);
+    }
+    return static_cast<T>(dst);
+}
+
+// Returns the underlying words as an array, lsbs first
+template <class WordType, std::size_t N>
+constexpr typename word_block<WordType, N>::array_type
+word_block<WordType, N>::to_array(
+) const noexcept
+{
+    array_type dst = {};
+    for (size_type i = 0; i < N; ++i) {
+        dst[i] = _words[i];
+    }
+    return dst;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------- WORD BLOCK: COMPOUND ASSIGNMENT OPERATORS ---------------- //
+// Assigns the word block through a bitwise and operation
+template <class WordType, std::size_t N>
+constexpr word_block<WordType, N>& word_block<WordType, N>::operator&=(
+    const word_block& other
+) noexcept
+{
+    for (size_type i = 0; i < N; ++i) {
+        _words[i] &= other._words[i];
+    }
+    return *this;
+}
+
+// Assigns the word block through a bitwise or operation
+template <class WordType, std::size_t N>
+constexpr word_block<WordType, N>& word_block<WordType, N>::operator|=(
+    const word_block& other
+) noexcept
+{
+    for (size_type i = 0; i < N; ++i) {
+        _words[i] |= other._words[i];
+    }
+    return *this;
+}
+
+// Assigns the word block through a bitwise xor operation
+template <class WordType, std::size_t N>
+constexpr word_block<WordType, N>& word_block<WordType, N>::operator^=(
+    const word_block& other
+) noexcept
+{
+    for (size_type i = 0; i < N; ++i) {
+        _words[i] ^= other._words[i];
+    }
+    return *this;
+}
+
+// Shifts the bits towards the msbs, filling with zeros past the capacity
+template <class WordType, std::size_t N>
+constexpr word_block<WordType, N>& word_block<WordType, N>::operator<<=(
+    size_type n
+) noexcept
+{
+    constexpr size_type digits = binary_digits<word_type>::value;
+    const size_type words = n / digits;
+    const size_type shift = n % digits;
+    for (size_type i = N; i-- > 0;) {
+        _words[i] = i < words ? word_type() : static_cast<word_type>(
+            _words[i - words] << shift
+            | (shift && i > words ? _words[i - words - 1] >> (digits - shift)
+                                  : word_type())
+        );
+    }
+    return *this;
+}
+
+// Shifts the bits towards the lsbs, filling with zeros past the capacity
+template <class WordType, std::size_t N>
+constexpr word_block<WordType, N>& word_block<WordType, N>::operator>>=(
+    size_type n
+) noexcept
+{
+    constexpr size_type digits = binary_digits<word_type>::value;
+    const size_type words = n / digits;
+    const size_type shift = n % digits;
+    for (size_type i = 0; i < N; ++i) {
+        _words[i] = i + words >= N ? word_type() : static_cast<word_type>(
+            _words[i + words] >> shift
+            | (shift && i + words + 1 < N
+              ? _words[i + words + 1] << (digits - shift)
+              : word_type())
+        );
+    }
+    return *this;
+}
+
+// Adds a word block, modulo the capacity
+template <class WordType, std::size_t N>
+constexpr word_block<WordType, N>& word_block<WordType, N>::operator+=(
+    const word_block& other
+) noexcept
+{
+    bool carry = false;
+    word_type sum = word_type();
+    for (size_type i = 0; i < N; ++i) {
+        sum = static_cast<word_type>(_words[i] + other._words[i] + carry);
+        carry = carry ? sum <= _words[i] : sum < _words[i];
+        _words[i] = sum;
+    }
+    return *this;
+}
+
+// Subtracts a word block, modulo the capacity
+template <class WordType, std::size_t N>
+constexpr word_block<WordType, N>& word_block<WordType, N>::operator-=(
+    const word_block& other
+) noexcept
+{
+    bool borrow = false;
+    word_type diff = word_type();
+    for (size_type i = 0; i < N; ++i) {
+        diff = static_cast<word_type>(_words[i] - other._words[i] - borrow);
+        borrow = borrow ? diff >= _words[i] : diff > _words[i];
+        _words[i] = diff;
+    }
+    return *this;
+}
+
+// Multiplies by a word block, keeping the lsbs of the product
+template <class WordType, std::size_t N>
+constexpr word_block<WordType, N>& word_block<WordType, N>::operator*=(
+    const word_block& other
+) noexcept
+{
+    word_block dst;
+    word_type lo = word_type();
+    word_type hi = word_type();
+    word_type carry = word_type();
+    for (size_type i = 0; i < N; ++i) {
+        carry = word_type();
+        for (size_type j = 0; i + j < N; ++j) {
+            lo = _mulx(_words[i], other._words[j], &hi);
+            lo = static_cast<word_type>(lo + carry);
+            hi = static_cast<word_type>(hi + (lo < carry));
+            dst._words[i + j] = static_cast<word_type>(dst._words[i + j] + lo);
+            carry = static_cast<word_type>(hi + (dst._words[i + j] < lo));
+        }
+    }
+    return *this = dst;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------- WORD BLOCK: IMPLEMENTATION DETAILS: FUNCTION MEMBERS ---------- //
+// Converts a shift count, saturating it to the capacity
+template <class WordType, std::size_t N>
+constexpr typename word_block<WordType, N>::size_type
+word_block<WordType, N>::_shift_count(
+    const word_block& src
+) noexcept
+{
+    constexpr size_type digits = binary_digits<word_block>::value;
+    word_type msbs = word_type();
+    for (size_type i = 1; i < N; ++i) {
+        msbs |= src._words[i];
+    }
+    return msbs || src._words[0] > digits ? digits : src._words[0];
+}
+
+// Compares two word blocks from their msbs, returning -1, 0 or 1
+template <class WordType, std::size_t N>
+constexpr int word_block<WordType, N>::_compare(
+    const word_block& lhs,
+    const word_block& rhs
+) noexcept
+{
+    int dst = 0;
+    for (size_type i = N; dst == 0 && i-- > 0;) {
+        dst = (lhs._words[i] > rhs._words[i]) - (lhs._words[i] < rhs._words[i]);
+    }
+    return dst;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------ IMPLEMENTATION DETAILS: WORD BLOCK INSTRUCTIONS: BIT COUNTS ------- //
+// Counts the number of bits set to 1 one underlying word at a time
+template <class WordType, std::size_t N>
+constexpr std::size_t _popcnt(
+    word_block<WordType, N> src
+) noexcept
+{
+    std::size_t dst = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        dst += _popcnt(src[i]);
+    }
+    return dst;
+}
+
+// Counts the number of leading zeros from the most significant word
+template <class WordType, std::size_t N>
+constexpr std::size_t _lzcnt(
+    word_block<WordType, N> src
+) noexcept
+{
+    constexpr std::size_t digits = binary_digits<WordType>::value;
+    std::size_t dst = 0;
+    std::size_t i = N;
+    while (i-- > 0 && src[i] == WordType()) {
+        dst += digits;
+    }
+    return i < N ? dst + _lzcnt(src[i]) : dst;
+}
+
+// Counts the number of trailing zeros from the least significant word
+template <class WordType, std::size_t N>
+constexpr std::size_t _tzcnt(
+    word_block<WordType, N> src
+) noexcept
+{
+    constexpr std::size_t digits = binary_digits<WordType>::value;
+    std::size_t dst = 0;
+    std::size_t i = 0;
+    for (; i < N && src[i] == WordType(); ++i) {
+        dst += digits;
+    }
+    return i < N ? dst + _tzcnt(src[i]) : dst;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------ IMPLEMENTATION DETAILS: WORD BLOCK INSTRUCTIONS: BIT FIELDS ------- //
+// Extracts to lsbs a field of contiguous bits of a word block
+template <class T>
+constexpr typename std::enable_if<_is_word_block<T>::value, T>::type _bextr(
+    T src,
+    T start,
+    T len
+) noexcept
+{
+    constexpr std::size_t digits = binary_digits<T>::value;
+    const std::size_t n = len < digits ? static_cast<std::size_t>(len) : digits;
+    return (src >> start) & (~T() >> (digits - n));
+}
+
+// Reverses the order of the bits, swapping the words and their bits
+template <class WordType, std::size_t N>
+constexpr word_block<WordType, N> _bitswap(
+    word_block<WordType, N> src
+) noexcept
+{
+    word_block<WordType, N> dst;
+    for (std::size_t i = 0; i < N; ++i) {
+        dst[i] = _bitswap(src[N - 1 - i]);
+    }
+    return dst;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+// ========================================================================== //
+
+
+
+// ================================= LIMITS ================================= //
+namespace std {
+// Numeric limits of word blocks: those of their words, scaled to the block
+template <class WordType, std::size_t N>
+class numeric_limits<bit::word_block<WordType, N>>
+: public numeric_limits<WordType>
+{
+    // Types
+    private:
+    using _block_t = bit::word_block<WordType, N>;
+
+    // Constants
+    public:
+    static constexpr int digits = N * numeric_limits<WordType>::digits;
+    static constexpr int digits10 = digits * 643L / 2136;
+
+    // Values
+    public:
+    static constexpr _block_t min() noexcept
+    {
+        return _block_t();
+    }
+    static constexpr _block_t lowest() noexcept
+    {
+        return _block_t();
+    }
+    static constexpr _block_t max() noexcept
+    {
+        return ~_block_t();
+    }
+};
+} // namespace std
+// ========================================================================== //
+
+
+
+// ========================================================================== //
+#endif // _BIT_WORD_BLOCK_HPP_INCLUDED
+// ========================================================================== //